@@ -0,0 +1,48 @@
+#include "geometry/Point.h"
+#include "geometry/Triangulation.h"
+#include "utils/delaunay.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Delaunay 三角剖分基准：单位正方形内均匀分布的随机点，默认 1M 与 10M 个点。
+// 用法: delaunay-benchmark [点数 ...]，请以 Release 模式构建（-DCMAKE_BUILD_TYPE=Release）
+int main(int argc, char* argv[]) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty()) {
+        sizes = {1000000, 10000000};
+    }
+
+    std::cout << std::fixed << std::setprecision(3);
+    for (std::size_t n : sizes) {
+        std::mt19937 rng(12345);
+        std::uniform_real_distribution<float> coordinate(0.0f, 1.0f);
+        std::vector<Point> points;
+        points.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const float x = coordinate(rng);
+            const float y = coordinate(rng);
+            points.emplace_back(x, y, 0.0f);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const Triangulation tin = geometry::utils::delaunay(points);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        // 无重复点时三角形数为 2n - 2 - h（h 为凸包顶点数），用来粗略检查结果
+        const std::size_t hull = tin.hull().size();
+        const bool consistent = tin.triangle_count() + 2 + hull == 2 * n;
+        std::cout << "n = " << n << ": " << elapsed.count() << " s, "
+                  << static_cast<double>(n) / elapsed.count() / 1e6 << " M 点/秒, 三角形数 = "
+                  << tin.triangle_count() << ", 凸包顶点数 = " << hull
+                  << (consistent ? "" : " (三角形数与 2n - 2 - h 不符，可能有重复点)") << std::endl;
+    }
+    return 0;
+}
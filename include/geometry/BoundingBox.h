@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Point.h"
+#include <algorithm>
+#include <iostream>
+
+/**
+ * @brief 表示3D空间中的轴对齐包围盒
+ */
+class BoundingBox
+{
+public:
+    Point min; ///< 各坐标的最小值
+    Point max; ///< 各坐标的最大值
+
+    explicit constexpr BoundingBox(const Point &min = Point{}, const Point &max = Point{}) noexcept
+        : min(min), max(max) {}
+
+    /**
+     * @brief 包围盒中心
+     */
+    [[nodiscard]]
+    Point center() const noexcept;
+
+    /**
+     * @brief 包围盒的半边长（每个坐标方向上的一半尺寸）
+     */
+    [[nodiscard]]
+    Point half_extent() const noexcept;
+
+    /**
+     * @brief 判断点是否在包围盒内（含边界）
+     * @param point 目标点
+     * @return 是否在包围盒内
+     */
+    [[nodiscard]]
+    bool contains(const Point &point) const noexcept;
+
+    /**
+     * @brief 扩展包围盒使其包含给定点
+     * @param point 目标点
+     */
+    void expand(const Point &point) noexcept;
+};
+
+// Stream operator
+std::ostream &operator<<(std::ostream &os, const BoundingBox &box);
+
+// ===== Implementation =====
+
+inline Point BoundingBox::center() const noexcept
+{
+    return Point((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f);
+}
+
+inline Point BoundingBox::half_extent() const noexcept
+{
+    return Point((max.x - min.x) * 0.5f, (max.y - min.y) * 0.5f, (max.z - min.z) * 0.5f);
+}
+
+inline bool BoundingBox::contains(const Point &point) const noexcept
+{
+    return point.x >= min.x && point.x <= max.x &&
+           point.y >= min.y && point.y <= max.y &&
+           point.z >= min.z && point.z <= max.z;
+}
+
+inline void BoundingBox::expand(const Point &point) noexcept
+{
+    min = Point(std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z));
+    max = Point(std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z));
+}
+
+inline std::ostream &operator<<(std::ostream &os, const BoundingBox &box)
+{
+    os << "BoundingBox[min=" << box.min << ", max=" << box.max << "]";
+    return os;
+}
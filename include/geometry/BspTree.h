@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Point.h"
+#include "Plane.h"
+#include "Polygon.h"
+#include "PolygonBuffer.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief BSP 树的构建参数
+ *
+ * 每个节点从剩余多边形中等间隔取 candidates 个作为候选分割平面，
+ * 用最多 sample_size 个多边形估计每个候选的代价：
+ * split_weight * 被切开的数量 + balance_weight * |正侧数量 - 负侧数量|，取代价最小者。
+ */
+struct BspBuildOptions {
+    std::size_t candidates = 8;    ///< 每个节点评估的候选平面数
+    std::size_t sample_size = 512; ///< 估计代价时最多检查的多边形数
+    float split_weight = 4.0f;     ///< 切分的代价权重（越大树越少切分）
+    float balance_weight = 1.0f;   ///< 不平衡的代价权重（越大树越平衡）
+    float epsilon = 1e-5f;         ///< 判断顶点在平面上的容差
+};
+
+/**
+ * @brief 3D 平面多边形的 BSP 树
+ *
+ * 节点按深度优先顺序扁平存放在 nodes() 中，正侧子树紧跟在父节点之后。
+ * 每个节点以一个输入多边形所在的平面为分割平面，与之共面的多边形片段
+ * 连续存放在 fragments() 的 [first, first + count) 区间。被分割平面切开的
+ * 多边形以多个片段出现，sources() 记录每个片段来自哪个输入多边形。
+ * 面积为零的退化多边形在构建时被丢弃。
+ */
+class BspTree {
+public:
+    /// 表示没有子节点
+    static constexpr std::int32_t kNoChild = -1;
+
+    /**
+     * @brief 扁平化的树节点
+     */
+    struct Node {
+        Plane plane;                     ///< 分割平面
+        std::int32_t front = kNoChild;   ///< 正侧子节点下标
+        std::int32_t back = kNoChild;    ///< 负侧子节点下标
+        std::uint32_t first = 0;         ///< 第一个共面片段的下标
+        std::uint32_t count = 0;         ///< 共面片段数
+    };
+
+    /**
+     * @brief 构造空树
+     */
+    BspTree() = default;
+
+    /**
+     * @brief 从多边形集合构建 BSP 树
+     * @param polygons 3D 平面多边形
+     * @param options 构建参数
+     */
+    explicit BspTree(const std::vector<Polygon>& polygons, const BspBuildOptions& options = BspBuildOptions{});
+
+    /**
+     * @brief 重新构建（替换当前内容）
+     * @param polygons 3D 平面多边形
+     * @param options 构建参数
+     * @throws std::length_error 如果片段数超过下标的表示范围
+     */
+    void build(const std::vector<Polygon>& polygons, const BspBuildOptions& options = BspBuildOptions{});
+
+    /**
+     * @brief 判断树是否为空
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * @brief 获取节点数组（下标0为根）
+     */
+    [[nodiscard]] const std::vector<Node>& nodes() const noexcept;
+
+    /**
+     * @brief 获取所有多边形片段
+     */
+    [[nodiscard]] const PolygonBuffer& fragments() const noexcept;
+
+    /**
+     * @brief 获取每个片段对应的输入多边形下标
+     */
+    [[nodiscard]] const std::vector<std::uint32_t>& sources() const noexcept;
+
+    /**
+     * @brief 构建时被切开的多边形次数
+     */
+    [[nodiscard]] std::size_t split_count() const noexcept;
+
+    /**
+     * @brief 树的深度（只有根节点时为1，空树为0）
+     */
+    [[nodiscard]] std::size_t depth() const noexcept;
+
+    /**
+     * @brief 按从近到远的顺序列出片段
+     * @param eye 视点
+     * @param out 片段下标（先被清空）；越靠前的片段越不可能被后面的片段遮挡
+     * @note 使用显式栈遍历，树很深时也不会栈溢出
+     */
+    void front_to_back(const Point& eye, std::vector<std::uint32_t>& out) const;
+
+    /**
+     * @brief 按从远到近的顺序列出片段（画家算法的绘制顺序）
+     * @param eye 视点
+     * @param out 片段下标（先被清空）
+     */
+    void back_to_front(const Point& eye, std::vector<std::uint32_t>& out) const;
+
+private:
+    std::vector<Node> nodes_;
+    PolygonBuffer fragments_;
+    std::vector<std::uint32_t> sources_;
+    std::size_t split_count_ = 0;
+    std::size_t depth_ = 0;
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Point.h"
+#include <cmath>
+#include <iostream>
+
+/**
+ * @brief 表示xy平面上的圆
+ */
+class Circle
+{
+public:
+    Point center;        ///< 圆心（z 坐标不参与计算）
+    float radius = 0.0f; ///< 半径
+
+    explicit constexpr Circle(const Point &center = Point{}, float radius = 0.0f) noexcept
+        : center(center), radius(radius) {}
+
+    /**
+     * @brief 判断点是否在圆内（含边界，只考虑xy坐标）
+     * @param point 目标点
+     * @param epsilon 容差
+     * @return 是否在圆内
+     */
+    [[nodiscard]]
+    bool contains(const Point &point, float epsilon = 1e-6f) const noexcept;
+
+    /**
+     * @brief 计算圆的面积
+     * @return 面积
+     */
+    [[nodiscard]]
+    float area() const noexcept;
+};
+
+// Stream operator
+std::ostream &operator<<(std::ostream &os, const Circle &circle);
+
+// ===== Implementation =====
+
+inline bool Circle::contains(const Point &point, float epsilon) const noexcept
+{
+    const double dx = static_cast<double>(point.x) - center.x;
+    const double dy = static_cast<double>(point.y) - center.y;
+    return std::hypot(dx, dy) <= static_cast<double>(radius) + epsilon;
+}
+
+inline float Circle::area() const noexcept
+{
+    return static_cast<float>(M_PI) * radius * radius;
+}
+
+inline std::ostream &operator<<(std::ostream &os, const Circle &circle)
+{
+    os << "Circle[center=" << circle.center << ", radius=" << circle.radius << "]";
+    return os;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Point.h"
+#include "Polygon.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 顶点/面表示的凸多面体
+ *
+ * 所有面的顶点下标连续存放在 face_indices 中，第 i 个面占据
+ * [face_offsets[i], face_offsets[i + 1]) 区间，从多面体外部看逆时针。
+ */
+class ConvexPolyhedron {
+public:
+    std::vector<Point> vertices;               ///< 顶点坐标
+    std::vector<std::uint32_t> face_indices;   ///< 所有面的顶点下标
+    std::vector<std::size_t> face_offsets{0};  ///< 每个面的起始偏移（末尾为下标总数）
+    std::vector<std::uint32_t> face_planes;    ///< 每个面所在的输入平面下标
+
+    /**
+     * @brief 获取面数
+     */
+    [[nodiscard]] std::size_t face_count() const noexcept;
+
+    /**
+     * @brief 获取第 i 个面的顶点数
+     * @param index 面下标
+     */
+    [[nodiscard]] std::size_t face_vertex_count(std::size_t index) const noexcept;
+
+    /**
+     * @brief 把第 i 个面复制为 Polygon 对象
+     * @param index 面下标
+     * @return 面多边形（从外部看逆时针）
+     * @throws std::out_of_range 如果下标越界
+     */
+    [[nodiscard]] Polygon face(std::size_t index) const;
+
+    /**
+     * @brief 把所有面扇形三角化
+     * @return 三角形顶点下标（每三个一组，从外部看逆时针）
+     */
+    [[nodiscard]] std::vector<std::uint32_t> triangles() const;
+
+    /**
+     * @brief 计算体积
+     * @return 体积（面的方向正确时为正）
+     */
+    [[nodiscard]] float volume() const noexcept;
+};
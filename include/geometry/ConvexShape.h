@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Point.h"
+#include "Polygon.h"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief 由顶点集合定义的凸形状（support 隐式取凸包）
+ *
+ * 形状通过支撑函数 support(d) 参与 GJK/EPA 查询，支撑函数返回
+ * 在方向 d 上最远的顶点下标。顶点在局部坐标系中存储，position 为
+ * 整体平移，移动形状时只需修改 position，顶点下标保持稳定，
+ * 因此上一帧的单纯形可以直接用于热启动。
+ */
+class ConvexShape {
+public:
+    std::vector<Point> vertices;  ///< 局部坐标系下的顶点
+    Point position;               ///< 形状的平移量
+
+    /**
+     * @brief 默认构造函数
+     */
+    ConvexShape() = default;
+
+    /**
+     * @brief 从3D点集构造凸形状，由顶点集合定义（support 隐式取凸包）
+     * @param vertices 顶点列表，无需有序，也无需剔除内部点
+     * @throws std::invalid_argument 如果顶点列表为空
+     */
+    explicit ConvexShape(const std::vector<Point>& vertices);
+
+    /**
+     * @brief 从凸多边形构造凸形状
+     * @param polygon 凸多边形（例如 Polygon::convex_hull 的结果）
+     * @throws std::invalid_argument 如果多边形没有顶点
+     * @note 多边形顶点是环形有序的，支撑函数会沿环爬山搜索
+     */
+    explicit ConvexShape(const Polygon& polygon);
+
+    /**
+     * @brief 支撑函数：返回在给定方向上最远的顶点下标
+     * @param direction 搜索方向（无需单位化）
+     * @param hint 搜索起点（对有序多边形有效，通常取上一次的结果）
+     * @note 有序多边形从 hint 爬山；遇到共线点或重复点造成的点积平台时退化为线性扫描
+     * @return 顶点下标
+     */
+    [[nodiscard]] std::size_t support(const Point& direction, std::size_t hint = 0) const noexcept;
+
+    /**
+     * @brief 获取世界坐标系下的顶点
+     * @param index 顶点下标
+     * @return 顶点加上平移量后的坐标
+     */
+    [[nodiscard]] Point vertex(std::size_t index) const noexcept;
+
+    /**
+     * @brief 判断顶点是否为有序凸多边形环
+     * @return 是否可以使用爬山搜索
+     */
+    [[nodiscard]] bool is_ordered_loop() const noexcept { return ordered_loop_; }
+
+private:
+    bool ordered_loop_ = false;
+};
+
+// Stream operator
+std::ostream& operator<<(std::ostream& os, const ConvexShape& shape);
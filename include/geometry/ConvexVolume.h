@@ -0,0 +1,157 @@
+#pragma once
+
+#include "Point.h"
+#include "Line.h"
+#include "Plane.h"
+#include "Sphere.h"
+#include "BoundingBox.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 物体相对凸体的位置关系
+ */
+enum class Containment : std::uint8_t {
+    Outside,      ///< 完全在凸体外
+    Intersecting, ///< 与凸体边界相交
+    Inside        ///< 完全在凸体内（含边界）
+};
+
+/**
+ * @brief 由若干平面围成的凸体，用于视锥体剔除
+ *
+ * 每个平面的法向量指向凸体内部，凸体是所有平面正侧（含平面本身）的交集。
+ * 平面按 SoA 形式存储并补齐到4的倍数，启用 SSE2 时一次测试4个平面。
+ *
+ * 包围盒使用 p-vertex/n-vertex 判定：盒中心到平面的距离与盒在法向量上的投影半径比较，
+ * 因此只对每个平面单独判定——盒与凸体的角落区域相离时可能报告为 Intersecting（保守结果，不会错误剔除）。
+ * 球同理。线段按参数区间逐平面裁剪，不做保守近似。
+ *
+ * 帧间一致性：批量接口可传入每个物体一个 hint，记录上一次把该物体判为 Outside 的平面组；
+ * 下一次先测试这组平面，静止或缓慢移动的物体通常第一组就被剔除。
+ */
+class ConvexVolume {
+public:
+    /// hint 的初始值，表示没有缓存的平面组
+    static constexpr std::uint32_t kNoHint = 0xFFFFFFFFu;
+
+    ConvexVolume() = default;
+
+    /**
+     * @brief 从一组平面构造凸体
+     * @param planes 平面（法向量指向凸体内部）
+     */
+    explicit ConvexVolume(const std::vector<Plane>& planes);
+
+    /**
+     * @brief 构造透视相机的视锥体（近、远、左、右、上、下六个平面）
+     * @param eye 相机位置
+     * @param forward 视线方向
+     * @param up 上方向（不必与 forward 正交）
+     * @param fov_y 垂直视场角（弧度）
+     * @param aspect 宽高比
+     * @param near_distance 近平面距离
+     * @param far_distance 远平面距离
+     * @return 视锥体
+     * @throws std::invalid_argument 如果 forward 与 up 平行或参数无效
+     */
+    [[nodiscard]] static ConvexVolume frustum(const Point& eye, const Point& forward, const Point& up,
+                                              float fov_y, float aspect, float near_distance, float far_distance);
+
+    /**
+     * @brief 添加一个平面
+     * @param plane 平面（法向量指向凸体内部）
+     */
+    void add_plane(const Plane& plane);
+
+    /**
+     * @brief 平面数量
+     */
+    [[nodiscard]] std::size_t plane_count() const noexcept;
+
+    /**
+     * @brief 获取第 index 个平面
+     */
+    [[nodiscard]] const Plane& plane(std::size_t index) const;
+
+    /**
+     * @brief 判断点的位置（点只会是 Inside 或 Outside）
+     */
+    [[nodiscard]] Containment classify(const Point& point) const noexcept;
+
+    /**
+     * @brief 判断轴对齐包围盒的位置
+     */
+    [[nodiscard]] Containment classify(const BoundingBox& box) const noexcept;
+
+    /**
+     * @brief 判断球的位置
+     */
+    [[nodiscard]] Containment classify(const Sphere& sphere) const noexcept;
+
+    /**
+     * @brief 判断线段的位置
+     */
+    [[nodiscard]] Containment classify(const Line& segment) const noexcept;
+
+    /**
+     * @brief 利用帧间一致性判断包围盒的位置
+     * @param box 包围盒
+     * @param hint 上一次剔除该物体的平面组，初始为 kNoHint；结果为 Outside 时会被更新
+     */
+    [[nodiscard]] Containment classify(const BoundingBox& box, std::uint32_t& hint) const noexcept;
+
+    /**
+     * @brief 利用帧间一致性判断球的位置
+     * @param sphere 球
+     * @param hint 上一次剔除该物体的平面组，初始为 kNoHint；结果为 Outside 时会被更新
+     */
+    [[nodiscard]] Containment classify(const Sphere& sphere, std::uint32_t& hint) const noexcept;
+
+    /**
+     * @brief 批量判断点的位置
+     * @param points 点数组
+     * @param count 点数
+     * @param out 输出数组（至少 count 个元素）
+     */
+    void classify(const Point* points, std::size_t count, Containment* out) const noexcept;
+
+    /**
+     * @brief 批量判断包围盒的位置
+     * @param boxes 包围盒数组
+     * @param count 包围盒数
+     * @param out 输出数组（至少 count 个元素）
+     * @param hints 每个包围盒一个 hint（可为 nullptr），在帧间保留以利用一致性
+     */
+    void classify(const BoundingBox* boxes, std::size_t count, Containment* out,
+                  std::uint32_t* hints = nullptr) const noexcept;
+
+    /**
+     * @brief 批量判断球的位置
+     * @param spheres 球数组
+     * @param count 球数
+     * @param out 输出数组（至少 count 个元素）
+     * @param hints 每个球一个 hint（可为 nullptr），在帧间保留以利用一致性
+     */
+    void classify(const Sphere* spheres, std::size_t count, Containment* out,
+                  std::uint32_t* hints = nullptr) const noexcept;
+
+    /**
+     * @brief 批量判断线段的位置
+     * @param segments 线段数组
+     * @param count 线段数
+     * @param out 输出数组（至少 count 个元素）
+     */
+    void classify(const Line* segments, std::size_t count, Containment* out) const noexcept;
+
+private:
+    // 中心为 (cx, cy, cz)、包围盒半边长为 (ex, ey, ez)、额外半径为 r 的物体；hint 可为 nullptr
+    Containment classify_bounds(float cx, float cy, float cz, float ex, float ey, float ez, float r,
+                                std::uint32_t* hint) const noexcept;
+
+    std::vector<Plane> planes_;
+    // SoA 平面数据，长度补齐到4的倍数；补齐的平面法向量为0、d 为 FLT_MAX，任何物体都在其正侧
+    std::vector<float> nx_, ny_, nz_, d_;
+    std::vector<float> ax_, ay_, az_; ///< 法向量各分量的绝对值，用于计算包围盒投影半径
+};
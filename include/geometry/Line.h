@@ -19,6 +19,12 @@ public:
     [[nodiscard]]
     float length() const noexcept;
 
+    /**
+     * @brief 判断两条线段在xy平面上是否相交（包括端点接触与共线重叠）
+     * @param other 另一条线段
+     * @return 是否相交
+     * @note 按 geometry::utils::predicate_policy() 选择精确谓词或旧的容差判断
+     */
     [[nodiscard]]
     bool intersects(const Line &other) const noexcept;
 
@@ -120,54 +126,6 @@ inline std::ostream &operator<<(std::ostream &os, const Line &line)
     return os;
 }
 
-inline bool Line::intersects(const Line &other) const noexcept
-{
-    // Implementation using cross product approach
-    constexpr float epsilon = std::numeric_limits<float>::epsilon() * 1e6;
-
-    const Point p1 = start;
-    const Point p2 = end;
-    const Point p3 = other.start;
-    const Point p4 = other.end;
-
-    // Calculate orientation values
-    const auto ccw = [epsilon](const Point &a, const Point &b, const Point &c)
-    {
-        const float val = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
-        return (val > epsilon) ? 1 : (val < -epsilon) ? -1
-                                                      : 0;
-    };
-
-    const int o1 = ccw(p1, p2, p3);
-    const int o2 = ccw(p1, p2, p4);
-    const int o3 = ccw(p3, p4, p1);
-    const int o4 = ccw(p3, p4, p2);
-
-    // General case
-    if (o1 != o2 && o3 != o4)
-        return true;
-
-    // Special cases (collinear points)
-    const auto on_segment = [epsilon](const Point &a, const Point &b, const Point &c)
-    {
-        return (a.x <= std::max(b.x, c.x) + epsilon &&
-                a.x >= std::min(b.x, c.x) - epsilon &&
-                a.y <= std::max(b.y, c.y) + epsilon &&
-                a.y >= std::min(b.y, c.y) - epsilon);
-    };
-
-    if (o1 == 0 && on_segment(p3, p1, p2))
-        return true;
-    if (o2 == 0 && on_segment(p4, p1, p2))
-        return true;
-    if (o3 == 0 && on_segment(p1, p3, p4))
-        return true;
-    if (o4 == 0 && on_segment(p2, p3, p4))
-        return true;
-
-    return false;
-}
-
 // ===== 实现 =====
 inline bool Line::contains(const Point &p, float epsilon) const noexcept
 {
@@ -2,13 +2,45 @@
 
 #include "Point.h"
 #include "Line.h"
+#include "Polygon.h"
+#include "PolygonBuffer.h"
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 
+/**
+ * @brief 点集按平面三路划分的结果
+ *
+ * 划分后缓冲区依次为 [0, front) 在法向量一侧，[front, front + on) 在平面上，
+ * 其余 back 个点在法向量反方向一侧。
+ */
+struct PlanePartition {
+    std::size_t front = 0; ///< 正侧点数
+    std::size_t on = 0;    ///< 平面上的点数
+    std::size_t back = 0;  ///< 负侧点数
+};
+
+/**
+ * @brief 多边形被平面切分的结果
+ *
+ * 跨越平面的多边形被切成正侧与负侧两块，恰好在平面上的顶点同时属于两块。
+ * 所有顶点都在平面上时 coplanar 为真，整个多边形按朝向归入一侧：
+ * 顶点绕平面法向量逆时针（朝向与法向量一致）时放入 front，否则放入 back。
+ */
+struct PolygonSplit {
+    Polygon front;         ///< 正侧部分（没有时为空）
+    Polygon back;          ///< 负侧部分（没有时为空）
+    bool coplanar = false; ///< 多边形是否与平面共面
+};
+
 /**
  * @brief 表示3D空间中的平面
  * 
  * 平面由一个点和一个法向量定义，方程形式为: ax + by + cz + d = 0
  * 其中 (a,b,c) 是法向量，d = -(ax0 + by0 + cz0)，(x0,y0,z0) 是平面上的点
+ *
+ * 常数项 d 不缓存，每次由 point 和 normal 求出，因此可以直接修改这两个成员；
+ * 批量接口在每次调用开始时计算一次 d。
  */
 class Plane {
 public:
@@ -41,6 +73,16 @@ public:
      */
     Plane(float a, float b, float c, float d);
 
+    /**
+     * @brief 用最小二乘拟合点集所在的平面
+     * @param points 点数组
+     * @param count 点数
+     * @return 经过质心、法向量为协方差矩阵最小特征值对应特征向量的平面；
+     *         点数少于3或平面不唯一（例如所有点重合或共线）时返回 std::nullopt
+     * @note 在双精度下累加协方差，3x3 对称矩阵的特征值用三角函数闭式解求出，不需要迭代
+     */
+    [[nodiscard]] static std::optional<Plane> fit(const Point* points, std::size_t count);
+
     /**
      * @brief 获取平面方程的常数项 d
      * @return 常数项 d，使得 ax + by + cz + d = 0
@@ -61,6 +103,55 @@ public:
      */
     [[nodiscard]] float distance_to(const Point& p) const noexcept;
 
+    /**
+     * @brief 批量计算有符号距离
+     * @param points 点数组
+     * @param count 点数
+     * @param out 输出数组（至少 count 个元素），out[i] 与 signed_distance_to(points[i]) 相同
+     * @note 在支持 SSE2 的平台上每次处理4个点
+     */
+    void signed_distances(const Point* points, std::size_t count, float* out) const noexcept;
+
+    /**
+     * @brief 批量判断点位于平面的哪一侧
+     * @param points 点数组
+     * @param count 点数
+     * @param out 输出数组（至少 count 个元素）：1 表示正侧，-1 表示负侧，0 表示距离不超过 epsilon
+     * @param epsilon 容差
+     */
+    void classify(const Point* points, std::size_t count, std::int8_t* out, float epsilon = 1e-6f) const noexcept;
+
+    /**
+     * @brief 原地把点集划分为正侧、平面上、负侧三段
+     * @param points 点数组（会被重新排列，各段内部的顺序不保证）
+     * @param count 点数
+     * @param epsilon 容差，与 classify 的判定一致
+     * @return 各段的点数
+     */
+    PlanePartition partition(Point* points, std::size_t count, float epsilon = 1e-6f) const noexcept;
+
+    /**
+     * @brief 用平面切分3D多边形
+     * @param polygon 平面多边形（顶点按顺序）
+     * @param epsilon 容差，距离不超过它的顶点视为在平面上
+     * @return 正侧与负侧部分，以及是否共面
+     * @note 交点总是从正侧端点开始插值，相邻多边形的公共边被切出的交点完全相同，不会产生裂缝
+     */
+    [[nodiscard]] PolygonSplit split(const Polygon& polygon, float epsilon = 1e-6f) const;
+
+    /**
+     * @brief 批量切分多边形
+     * @param polygons 多边形数组
+     * @param count 多边形数
+     * @param front 正侧输出缓冲区（先清空再写入），第 i 个多边形对应 front 中的第 i 个（可能为空）
+     * @param back 负侧输出缓冲区（先清空再写入），与 front 一样按输入下标一一对应
+     * @param coplanar 输出数组（至少 count 个元素，可为 nullptr），记录每个多边形是否共面
+     * @param epsilon 容差
+     * @note 结果与逐个调用 split 相同；顶点距离用 signed_distances 批量计算，缓冲区容量在多次调用之间复用
+     */
+    void split(const Polygon* polygons, std::size_t count, PolygonBuffer& front, PolygonBuffer& back,
+               bool* coplanar = nullptr, float epsilon = 1e-6f) const;
+
     /**
      * @brief 判断直线是否与平面相交
      * @param line 目标直线
@@ -38,6 +38,12 @@ public:
      */
     [[nodiscard]] float area() const noexcept;
 
+    /**
+     * @brief 计算多边形在xy平面上的有符号面积
+     * @return 有符号面积（逆时针为正，顺时针为负）
+     */
+    [[nodiscard]] float signed_area() const noexcept;
+
     /**
      * @brief 判断点是否在多边形内部
      * @param point 目标点
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Point.h"
+#include "Polygon.h"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @brief 扁平存储多个多边形的可复用缓冲区
+ *
+ * 所有多边形的顶点连续存放在 vertices 中，第 i 个多边形占据
+ * [offsets[i], offsets[i + 1]) 区间。clear() 只重置长度而保留容量，
+ * 因此在循环中反复写入结果不会产生新的内存分配。
+ */
+class PolygonBuffer {
+public:
+    std::vector<Point> vertices;                  ///< 所有多边形的顶点
+    std::vector<std::size_t> offsets{0};          ///< 每个多边形的起始偏移（末尾为总顶点数）
+
+    /**
+     * @brief 清空缓冲区（保留已分配的容量）
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief 获取多边形数量
+     * @return 已完成的多边形数量
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @brief 判断缓冲区是否为空
+     * @return 是否没有任何多边形
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * @brief 向当前正在构建的多边形追加顶点
+     * @param point 顶点
+     */
+    void add_vertex(const Point& point);
+
+    /**
+     * @brief 结束当前多边形（之后追加的顶点属于下一个多边形）
+     */
+    void close_polygon();
+
+    /**
+     * @brief 追加一个完整的多边形
+     * @param polygon 多边形
+     */
+    void add_polygon(const Polygon& polygon);
+
+    /**
+     * @brief 获取第 i 个多边形的顶点数
+     * @param index 多边形下标
+     * @return 顶点数
+     */
+    [[nodiscard]] std::size_t vertex_count(std::size_t index) const noexcept;
+
+    /**
+     * @brief 获取第 i 个多边形的首顶点指针
+     * @param index 多边形下标
+     * @return 指向连续存储的顶点
+     */
+    [[nodiscard]] const Point* data(std::size_t index) const noexcept;
+
+    /**
+     * @brief 把第 i 个多边形复制为 Polygon 对象
+     * @param index 多边形下标
+     * @return 多边形
+     * @throws std::out_of_range 如果下标越界
+     */
+    [[nodiscard]] Polygon polygon(std::size_t index) const;
+};
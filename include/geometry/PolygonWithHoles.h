@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Point.h"
+#include "Polygon.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief 带洞的2D多边形
+ *
+ * 由一个外边界和若干个互不相交、完全位于外边界内部的洞组成。
+ * 外边界和洞的顶点顺序任意，计算时按需要统一方向。
+ */
+class PolygonWithHoles {
+public:
+    Polygon outer;              ///< 外边界
+    std::vector<Polygon> holes; ///< 洞
+
+    /**
+     * @brief 默认构造函数
+     */
+    PolygonWithHoles() = default;
+
+    /**
+     * @brief 从外边界构造（没有洞）
+     * @param outer 外边界
+     */
+    explicit PolygonWithHoles(const Polygon& outer);
+
+    /**
+     * @brief 从外边界和洞构造
+     * @param outer 外边界
+     * @param holes 洞列表
+     */
+    PolygonWithHoles(const Polygon& outer, const std::vector<Polygon>& holes);
+
+    /**
+     * @brief 添加一个洞
+     * @param hole 洞的边界
+     */
+    void add_hole(const Polygon& hole);
+
+    /**
+     * @brief 计算面积（外边界面积减去所有洞的面积）
+     * @return 面积
+     */
+    [[nodiscard]] float area() const noexcept;
+
+    /**
+     * @brief 计算所有边界的总长度
+     * @return 周长
+     */
+    [[nodiscard]] float perimeter() const noexcept;
+
+    /**
+     * @brief 判断点是否在区域内（在外边界内且不在任何洞内）
+     * @param point 目标点
+     * @param include_boundary 是否包含边界（包括洞的边界）
+     * @return 是否在区域内
+     */
+    [[nodiscard]] bool contains_point(const Point& point, bool include_boundary = true) const noexcept;
+
+    /**
+     * @brief 获取所有边界的顶点总数
+     * @return 顶点数
+     */
+    [[nodiscard]] std::size_t vertex_count() const noexcept;
+};
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Point.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 动态点集的均匀空间哈希网格
+ *
+ * 单元格表采用开放寻址，每个单元格用侵入式双向链表串起其中的点，
+ * 因此插入、删除、移动都是 O(1)。rebuild() 以单元格在表中的下标为键做计数排序，
+ * 一次性重建：存储槽位按单元格下标排列，同一单元格的点在内存中连续存放
+ * （保持输入顺序），半径查询只需顺序扫描少量连续区间。
+ *
+ * 每个点由插入时返回的 Id 标识；rebuild() 之后第 i 个输入点的 Id 为 i。
+ * 被删除的 Id 会在之后的插入中复用。
+ */
+class SpatialHash {
+public:
+    using Id = std::uint32_t;
+
+    /**
+     * @brief 构造空的空间哈希
+     * @param cell_size 单元格边长（通常取最常用的查询半径）
+     * @throws std::invalid_argument 如果边长不是正数
+     */
+    explicit SpatialHash(float cell_size);
+
+    /**
+     * @brief 获取单元格边长
+     * @return 边长
+     */
+    [[nodiscard]] float cell_size() const noexcept;
+
+    /**
+     * @brief 获取点的数量
+     * @return 当前存储的点数
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @brief 判断是否为空
+     * @return 是否没有任何点
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * @brief 删除所有点（保留已分配的容量）
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief 用新的点集整体替换当前内容
+     * @param points 点集，第 i 个点的 Id 为 i
+     * @throws std::length_error 如果点数超过 Id 的表示范围
+     * @note 只需对点集做两次线性扫描，适合每帧整体重建
+     */
+    void rebuild(const std::vector<Point>& points);
+
+    /**
+     * @brief 插入一个点
+     * @param point 位置
+     * @return 新点的 Id
+     * @throws std::length_error 如果点数超过 Id 的表示范围
+     */
+    Id insert(const Point& point);
+
+    /**
+     * @brief 删除一个点
+     * @param id 点的 Id
+     * @throws std::out_of_range 如果 Id 无效
+     */
+    void remove(Id id);
+
+    /**
+     * @brief 移动一个点
+     * @param id 点的 Id
+     * @param point 新位置
+     * @throws std::out_of_range 如果 Id 无效
+     * @note 仍在同一单元格内时只更新坐标
+     */
+    void move(Id id, const Point& point);
+
+    /**
+     * @brief 判断 Id 是否对应一个现存的点
+     * @param id 点的 Id
+     * @return 是否有效
+     */
+    [[nodiscard]] bool contains(Id id) const noexcept;
+
+    /**
+     * @brief 获取点的位置
+     * @param id 点的 Id
+     * @return 位置
+     * @throws std::out_of_range 如果 Id 无效
+     */
+    [[nodiscard]] const Point& position(Id id) const;
+
+    /**
+     * @brief 查询到 center 距离不超过 radius 的所有点
+     * @param center 查询中心
+     * @param radius 查询半径
+     * @param out 输出的 Id 列表（先被清空，顺序不确定）
+     */
+    void query_radius(const Point& center, float radius, std::vector<Id>& out) const;
+
+    /**
+     * @brief 查询到 center 距离不超过 radius 的所有点
+     * @param center 查询中心
+     * @param radius 查询半径
+     * @return Id 列表
+     */
+    [[nodiscard]] std::vector<Id> query_radius(const Point& center, float radius) const;
+
+private:
+    static constexpr std::uint32_t kNone = 0xFFFFFFFFu;
+
+    struct Cell {
+        std::int32_t x = 0, y = 0, z = 0;
+        std::uint32_t head = kNone;   ///< 链表首个存储槽位
+        std::uint32_t count = 0;      ///< 单元格内的点数
+        std::uint32_t generation = 0; ///< 与表的版本号不同时视为空槽位
+    };
+
+    float cell_size_;
+    float inv_cell_size_;
+    std::uint32_t generation_ = 1;
+    std::size_t cells_used_ = 0;
+    std::vector<Cell> cells_;
+
+    // 按存储槽位索引，rebuild() 之后同一单元格的槽位连续
+    std::vector<Point> positions_;
+    std::vector<std::uint32_t> cell_of_slot_;
+    std::vector<std::uint32_t> next_;
+    std::vector<std::uint32_t> prev_;
+    std::vector<Id> id_of_slot_;
+    std::vector<std::uint32_t> free_slots_;
+
+    std::vector<std::uint32_t> slot_of_id_;
+    std::vector<Id> free_ids_;
+    std::size_t count_ = 0;
+
+    void cell_coords(const Point& point, std::int32_t& x, std::int32_t& y, std::int32_t& z) const noexcept;
+    [[nodiscard]] std::uint32_t find_cell(std::int32_t x, std::int32_t y, std::int32_t z) const noexcept;
+    std::uint32_t acquire_cell(std::int32_t x, std::int32_t y, std::int32_t z);
+    void reserve_cells(std::size_t count);
+    void rehash(std::size_t capacity);
+    void link(std::uint32_t slot, std::uint32_t cell) noexcept;
+    void unlink(std::uint32_t slot) noexcept;
+    [[nodiscard]] std::uint32_t checked_slot(Id id) const;
+};
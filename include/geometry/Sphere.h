@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Point.h"
+#include <iostream>
+
+/**
+ * @brief 表示3D空间中的球
+ */
+class Sphere
+{
+public:
+    Point center;        ///< 球心
+    float radius = 0.0f; ///< 半径
+
+    explicit constexpr Sphere(const Point &center = Point{}, float radius = 0.0f) noexcept
+        : center(center), radius(radius) {}
+
+    /**
+     * @brief 判断点是否在球内（含边界）
+     * @param point 目标点
+     * @param epsilon 容差
+     * @return 是否在球内
+     */
+    [[nodiscard]]
+    bool contains(const Point &point, float epsilon = 1e-6f) const noexcept;
+
+    /**
+     * @brief 计算点到球面的有符号距离
+     * @param point 目标点
+     * @return 有符号距离（球内为负）
+     */
+    [[nodiscard]]
+    float signed_distance_to(const Point &point) const noexcept;
+};
+
+// Stream operator
+std::ostream &operator<<(std::ostream &os, const Sphere &sphere);
+
+// ===== Implementation =====
+
+inline bool Sphere::contains(const Point &point, float epsilon) const noexcept
+{
+    return signed_distance_to(point) <= epsilon;
+}
+
+inline float Sphere::signed_distance_to(const Point &point) const noexcept
+{
+    return static_cast<float>(center.distance_to(point)) - radius;
+}
+
+inline std::ostream &operator<<(std::ostream &os, const Sphere &sphere)
+{
+    os << "Sphere[center=" << sphere.center << ", radius=" << sphere.radius << "]";
+    return os;
+}
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "Point.h"
+#include "BoundingBox.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+/**
+ * @brief 三角形 BVH 的构建参数
+ *
+ * 每个节点把三角形质心沿三个坐标轴各分到 bins 个桶中，按表面积启发式（SAH）
+ * 选择代价最小的分割；三角形数不超过 max_leaf_size 时成为叶子。
+ */
+struct BvhBuildOptions {
+    std::size_t max_leaf_size = 4; ///< 叶子最多包含的三角形数
+    std::size_t bins = 16;         ///< 每个轴上的 SAH 桶数
+};
+
+/**
+ * @brief 射线-三角形求交算法
+ */
+enum class TriangleTest {
+    MollerTrumbore, ///< Möller–Trumbore，速度快，射线恰好穿过公共边时可能漏检
+    Watertight      ///< Woop–Benthin–Wald 水密算法，公共边和公共顶点不会漏检
+};
+
+/**
+ * @brief 射线与 BVH 中三角形的最近交点
+ *
+ * 交点为 (1 - u - v) * a + u * b + v * c，其中 a、b、c 为三角形的三个顶点。
+ */
+struct TriangleHit {
+    float t = std::numeric_limits<float>::infinity(); ///< 射线参数，没有命中时为 +inf
+    float u = 0.0f;                                    ///< 顶点 b 的重心坐标
+    float v = 0.0f;                                    ///< 顶点 c 的重心坐标
+    std::uint32_t triangle = 0xFFFFFFFFu;              ///< 输入三角形下标，没有命中时为 TriangleBvh::kNoTriangle
+};
+
+/**
+ * @brief 三角网格的包围体层次（BVH），用于批量射线求交与可见性查询
+ *
+ * 节点按深度优先顺序扁平存放，左子节点紧跟在父节点之后。叶子中的三角形
+ * 按叶子顺序重新排列，顶点坐标连续存放，遍历时不需要再通过下标间接访问。
+ *
+ * 批量查询把4条射线打成一个包，用 SSE2 同时与节点包围盒和三角形求交，
+ * 包内任一射线与包围盒相交就进入该节点；射线之间方向越一致（如地形上的视线、
+ * 同一视点发出的相邻像素射线），包的效率越高。射线包被分块在多个线程上处理。
+ */
+class TriangleBvh {
+public:
+    /// 表示没有命中三角形
+    static constexpr std::uint32_t kNoTriangle = 0xFFFFFFFFu;
+
+    /**
+     * @brief 扁平化的树节点
+     *
+     * count > 0 为叶子，包含重新排列后的第 [offset, offset + count) 个三角形；
+     * count == 0 为内部节点，左子节点下标为当前下标 + 1，右子节点下标为 offset。
+     */
+    struct Node {
+        BoundingBox bounds;       ///< 包围盒（按坐标量级向外扩展了几个 ulp）
+        std::uint32_t offset = 0; ///< 第一个三角形或右子节点的下标
+        std::uint16_t count = 0;  ///< 三角形数（内部节点为0）
+        std::uint16_t axis = 0;   ///< 内部节点的分割轴
+    };
+
+    /**
+     * @brief 构造空的 BVH
+     */
+    TriangleBvh() = default;
+
+    /**
+     * @brief 从索引三角网格构建 BVH
+     * @param vertices 顶点坐标
+     * @param triangles 三角形顶点下标（每三个一组）
+     * @param options 构建参数
+     */
+    TriangleBvh(const std::vector<Point>& vertices, const std::vector<std::uint32_t>& triangles,
+                const BvhBuildOptions& options = BvhBuildOptions{});
+
+    /**
+     * @brief 重新构建（替换当前内容）
+     * @param vertices 顶点坐标
+     * @param triangles 三角形顶点下标（每三个一组）
+     * @param options 构建参数
+     * @throws std::invalid_argument 如果三角形下标数量不是3的倍数，或 max_leaf_size、bins 为0
+     * @throws std::out_of_range 如果三角形下标越界
+     * @throws std::length_error 如果三角形数超过下标的表示范围
+     */
+    void build(const std::vector<Point>& vertices, const std::vector<std::uint32_t>& triangles,
+               const BvhBuildOptions& options = BvhBuildOptions{});
+
+    /**
+     * @brief 判断是否为空
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * @brief 获取三角形数
+     */
+    [[nodiscard]] std::size_t triangle_count() const noexcept;
+
+    /**
+     * @brief 获取节点数组（下标0为根）
+     */
+    [[nodiscard]] const std::vector<Node>& nodes() const noexcept;
+
+    /**
+     * @brief 获取树的深度（只有根节点时为1）
+     */
+    [[nodiscard]] std::size_t depth() const noexcept;
+
+    /**
+     * @brief 求单条射线的最近交点
+     * @param origin 射线起点
+     * @param direction 射线方向（不要求单位长度）
+     * @param t_min 有效参数区间下界
+     * @param t_max 有效参数区间上界
+     * @param test 求交算法
+     * @return 最近交点；参数相同时取下标较小的三角形；没有命中时返回 std::nullopt
+     */
+    [[nodiscard]] std::optional<TriangleHit> intersect(const Point& origin, const Point& direction,
+                                                       float t_min = 0.0f,
+                                                       float t_max = std::numeric_limits<float>::infinity(),
+                                                       TriangleTest test = TriangleTest::MollerTrumbore) const noexcept;
+
+    /**
+     * @brief 判断单条射线在参数区间内是否被任何三角形遮挡
+     * @param origin 射线起点
+     * @param direction 射线方向
+     * @param t_min 有效参数区间下界
+     * @param t_max 有效参数区间上界（视线查询取 direction = target - origin、t_max = 1）
+     * @param test 求交算法
+     * @return 是否被遮挡（找到任意一个交点就立即返回）
+     */
+    [[nodiscard]] bool occluded(const Point& origin, const Point& direction, float t_min = 0.0f,
+                                float t_max = std::numeric_limits<float>::infinity(),
+                                TriangleTest test = TriangleTest::MollerTrumbore) const noexcept;
+
+    /**
+     * @brief 批量求最近交点
+     * @param origins 射线起点数组
+     * @param directions 射线方向数组
+     * @param count 射线数
+     * @param out 输出数组（至少 count 个元素），没有命中的射线 triangle 为 kNoTriangle、t 为 +inf
+     * @param t_min 有效参数区间下界
+     * @param t_max 有效参数区间上界
+     * @param test 求交算法
+     * @return 命中的射线数
+     * @note 结果与逐条调用 intersect 完全相同
+     */
+    std::size_t intersect(const Point* origins, const Point* directions, std::size_t count, TriangleHit* out,
+                          float t_min = 0.0f, float t_max = std::numeric_limits<float>::infinity(),
+                          TriangleTest test = TriangleTest::MollerTrumbore) const;
+
+    /**
+     * @brief 批量遮挡查询（视线、阴影射线）
+     * @param origins 射线起点数组
+     * @param directions 射线方向数组
+     * @param count 射线数
+     * @param out 输出数组（至少 count 个元素），记录每条射线是否被遮挡
+     * @param t_min 有效参数区间下界
+     * @param t_max 有效参数区间上界
+     * @param test 求交算法
+     * @return 被遮挡的射线数
+     * @note 包内所有射线都已确定被遮挡时提前结束遍历
+     */
+    std::size_t occluded(const Point* origins, const Point* directions, std::size_t count, bool* out,
+                         float t_min = 0.0f, float t_max = std::numeric_limits<float>::infinity(),
+                         TriangleTest test = TriangleTest::MollerTrumbore) const;
+
+private:
+    std::vector<Node> nodes_;
+    std::vector<Point> corners_;           ///< 按叶子顺序排列的三角形顶点（每三个一组）
+    std::vector<std::uint32_t> triangles_; ///< 按叶子顺序排列的输入三角形下标
+    std::size_t depth_ = 0;
+};
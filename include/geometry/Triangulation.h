@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Point.h"
+#include "Polygon.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 紧凑的半边结构三角剖分
+ *
+ * 第 t 个三角形的三个顶点为 triangles[3t], triangles[3t+1], triangles[3t+2]
+ * （逆时针，存储的是 points 中的下标）。半边 e 从 triangles[e] 指向
+ * triangles[next_halfedge(e)]，halfedges[e] 为同一条边在相邻三角形中的
+ * 反向半边，凸包边上为 -1。
+ */
+class Triangulation {
+public:
+    std::vector<Point> points;             ///< 顶点坐标
+    std::vector<std::uint32_t> triangles;  ///< 三角形顶点下标（每三个一组）
+    std::vector<std::int32_t> halfedges;   ///< 每条半边的反向半边（-1 表示凸包边）
+
+    /**
+     * @brief 获取三角形数量
+     * @return 三角形数量
+     */
+    [[nodiscard]] std::size_t triangle_count() const noexcept;
+
+    /**
+     * @brief 获取同一三角形中的下一条半边
+     * @param edge 半边下标
+     * @return 下一条半边
+     */
+    [[nodiscard]] static std::size_t next_halfedge(std::size_t edge) noexcept;
+
+    /**
+     * @brief 获取同一三角形中的上一条半边
+     * @param edge 半边下标
+     * @return 上一条半边
+     */
+    [[nodiscard]] static std::size_t prev_halfedge(std::size_t edge) noexcept;
+
+    /**
+     * @brief 把第 i 个三角形复制为 Polygon 对象
+     * @param index 三角形下标
+     * @return 三个顶点组成的多边形（逆时针）
+     * @throws std::out_of_range 如果下标越界
+     */
+    [[nodiscard]] Polygon triangle(std::size_t index) const;
+
+    /**
+     * @brief 按逆时针顺序获取凸包上的顶点下标
+     * @return 凸包顶点下标（三角剖分为空时为空）
+     */
+    [[nodiscard]] std::vector<std::uint32_t> hull() const;
+};
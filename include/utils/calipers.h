@@ -0,0 +1,50 @@
+#pragma once
+
+#include "geometry/Point.h"
+#include "geometry/Polygon.h"
+#include <utility>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 用旋转卡壳求凸多边形上距离最远的两个顶点（直径）
+ * @param hull 凸多边形（例如 Polygon::convex_hull 的结果，顺时针或逆时针均可）
+ * @return 最远点对（多边形为空时返回两个原点）
+ * @note 时间复杂度 O(n)
+ */
+[[nodiscard]] std::pair<Point, Point> farthest_pair(const Polygon& hull);
+
+/**
+ * @brief 计算凸多边形的直径
+ * @param hull 凸多边形
+ * @return 最远点对之间的距离
+ */
+[[nodiscard]] float diameter(const Polygon& hull);
+
+/**
+ * @brief 计算凸多边形的最小宽度（两条平行支撑线之间的最小距离）
+ * @param hull 凸多边形
+ * @return 最小宽度（顶点少于3个时为0）
+ * @note 时间复杂度 O(n)
+ */
+[[nodiscard]] float minimum_width(const Polygon& hull);
+
+/**
+ * @brief 计算凸多边形的最小面积外接矩形
+ * @param hull 凸多边形
+ * @return 外接矩形的四个角点（逆时针），z 坐标取第一个顶点的 z
+ * @note 最优矩形必有一条边与多边形的某条边共线，时间复杂度 O(n)
+ */
+[[nodiscard]] Polygon min_area_rectangle(const Polygon& hull);
+
+/**
+ * @brief 计算凸多边形的最小周长外接矩形
+ * @param hull 凸多边形
+ * @return 外接矩形的四个角点（逆时针），z 坐标取第一个顶点的 z
+ * @note 时间复杂度 O(n)
+ */
+[[nodiscard]] Polygon min_perimeter_rectangle(const Polygon& hull);
+
+} // namespace utils
+} // namespace geometry
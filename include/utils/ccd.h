@@ -0,0 +1,138 @@
+#pragma once
+
+#include "geometry/Point.h"
+#include "geometry/Line.h"
+#include "geometry/Polygon.h"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 连续碰撞检测的参数
+ *
+ * 运动在时间区间 [0, 1] 内线性插值：线段的两个端点分别从 from 的端点匀速移动到 to 的端点。
+ */
+struct ToiOptions {
+    float tolerance = 1e-4f;         ///< 距离不超过该值即视为接触；距离小于 tolerance / 2 的时刻不会被跳过
+    std::size_t max_iterations = 64; ///< 保守前进的最大迭代次数
+};
+
+/**
+ * @brief 首次接触（time of impact）
+ */
+struct TimeOfImpact {
+    float time = 0.0f;          ///< 接触时刻 [0, 1]
+    Point point_a;              ///< 接触时第一个对象上的最近点
+    Point point_b;              ///< 接触时第二个对象上的最近点
+    float distance = 0.0f;      ///< 接触时的距离（converged 为真时不超过 tolerance）
+    std::size_t iterations = 0; ///< 迭代次数
+    bool converged = true;      ///< 距离是否已降到 tolerance 以内；为 false 表示迭代次数用完，并未确认接触
+};
+
+/**
+ * @brief 一组对象中最早发生的接触
+ */
+struct PairImpact {
+    std::uint32_t first = 0;  ///< 第一个对象的下标
+    std::uint32_t second = 0; ///< 第二个对象的下标
+    TimeOfImpact impact;      ///< 接触信息
+};
+
+/**
+ * @brief 求两条运动线段的首次接触时刻（保守前进法）
+ * @param from 第一条线段在 t = 0 时的位置
+ * @param to 第一条线段在 t = 1 时的位置
+ * @param other_from 第二条线段在 t = 0 时的位置
+ * @param other_to 第二条线段在 t = 1 时的位置（静止线段取与 other_from 相同）
+ * @param options 参数
+ * @return 首次接触；[0, 1] 内不接触时返回 std::nullopt。迭代次数用完时返回 converged 为 false 的结果，
+ *         其 time 不晚于真实的接触时刻（如果有），但不表示已经接触
+ * @throws std::invalid_argument 如果 tolerance 不为正或 max_iterations 为0
+ * @note 每一步用 segment_closest_points 求当前距离 d，再前进一段一定不会越过接触时刻的时间：
+ *       d - tolerance / 2 除以端点之间相对速度的上界，或沿最近点方向的分离距离降到 tolerance / 2 所需的时间
+ *       （平移时一步到位），取较大者。
+ *       因此不会漏掉薄物体或高速运动中的碰撞；线段退化为点时即为运动点的查询
+ */
+[[nodiscard]] std::optional<TimeOfImpact> time_of_impact(const Line& from, const Line& to, const Line& other_from,
+                                                         const Line& other_to, const ToiOptions& options = ToiOptions{});
+
+/**
+ * @brief 求运动线段与静止多边形的首次接触时刻（保守前进法）
+ * @param from 线段在 t = 0 时的位置
+ * @param to 线段在 t = 1 时的位置
+ * @param polygon 静止多边形
+ * @param options 参数
+ * @return 首次接触，point_b 为多边形上的最近点；不接触时返回 std::nullopt，迭代次数用完时的约定同上
+ * @throws std::invalid_argument 如果 tolerance 不为正或 max_iterations 为0
+ * @note 与 Polygon::contains_point 一致，多边形视为 xy 平面上的区域，只考虑运动在 xy 平面上的投影；
+ *       线段有端点落在多边形内部时距离为0
+ */
+[[nodiscard]] std::optional<TimeOfImpact> time_of_impact(const Line& from, const Line& to, const Polygon& polygon,
+                                                         const ToiOptions& options = ToiOptions{});
+
+/**
+ * @brief 求运动点与静止多边形的首次接触时刻
+ * @param from 点在 t = 0 时的位置
+ * @param to 点在 t = 1 时的位置
+ * @param polygon 静止多边形
+ * @param options 参数
+ * @return 首次接触；不接触时返回 std::nullopt
+ * @throws std::invalid_argument 如果 tolerance 不为正或 max_iterations 为0
+ */
+[[nodiscard]] std::optional<TimeOfImpact> time_of_impact(const Point& from, const Point& to, const Polygon& polygon,
+                                                         const ToiOptions& options = ToiOptions{});
+
+/**
+ * @brief 粗筛：找出扫掠包围盒重叠的运动线段对
+ * @param from 各线段在 t = 0 时的位置
+ * @param to 各线段在 t = 1 时的位置（与 from 一一对应）
+ * @param margin 包围盒向外扩展的距离（通常取 tolerance）
+ * @return 候选线段对 (i, j)，i < j，按字典序排列
+ * @throws std::invalid_argument 如果 from 与 to 数量不同
+ * @throws std::length_error 如果线段数超过下标的表示范围
+ * @note 线段在整个时间区间内都位于四个端点的包围盒中；包围盒按 x 下界排序后扫描，
+ *       只有 x 区间重叠的线段才比较 y、z
+ */
+[[nodiscard]] std::vector<std::pair<std::uint32_t, std::uint32_t>> swept_box_pairs(const std::vector<Line>& from,
+                                                                                   const std::vector<Line>& to,
+                                                                                   float margin = 0.0f);
+
+/**
+ * @brief 在给定的候选线段对中求最早的接触
+ * @param from 各线段在 t = 0 时的位置
+ * @param to 各线段在 t = 1 时的位置
+ * @param pairs 候选线段对（通常来自 swept_box_pairs，可先去掉相邻连杆等无需检测的对）
+ * @param options 参数
+ * @return 最早的接触；时刻相同时取 (first, second) 较小的一对；都不接触时返回 std::nullopt。
+ *         未收敛的候选对按其时刻下界参与比较，结果的 impact.converged 为 false 时表示最早的候选未确认接触
+ * @throws std::invalid_argument 如果 from 与 to 数量不同、tolerance 不为正或 max_iterations 为0
+ * @throws std::out_of_range 如果候选对的下标越界
+ * @note 各候选对分块在多个线程上计算，并共享当前最早时刻：前进超过它的线段对提前放弃
+ */
+[[nodiscard]] std::optional<PairImpact> earliest_impact(const std::vector<Line>& from, const std::vector<Line>& to,
+                                                        const std::vector<std::pair<std::uint32_t, std::uint32_t>>& pairs,
+                                                        const ToiOptions& options = ToiOptions{});
+
+/**
+ * @brief 求一组运动线段与静止多边形之间最早的接触
+ * @param from 各线段在 t = 0 时的位置
+ * @param to 各线段在 t = 1 时的位置
+ * @param obstacles 静止多边形（xy 平面上的区域）
+ * @param options 参数
+ * @return 最早的接触，first 为线段下标、second 为多边形下标；都不接触时返回 std::nullopt，
+ *         未收敛的候选对的处理同上
+ * @throws std::invalid_argument 如果 from 与 to 数量不同、tolerance 不为正或 max_iterations 为0
+ * @throws std::length_error 如果线段数或多边形数超过下标的表示范围
+ * @note 先用 xy 平面上的扫掠包围盒与多边形包围盒粗筛，再对候选对做保守前进
+ */
+[[nodiscard]] std::optional<PairImpact> earliest_impact(const std::vector<Line>& from, const std::vector<Line>& to,
+                                                        const std::vector<Polygon>& obstacles,
+                                                        const ToiOptions& options = ToiOptions{});
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "geometry/Point.h"
+#include "geometry/ConvexShape.h"
+#include <cstddef>
+#include <optional>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief GJK 热启动缓存
+ *
+ * 记录上一次查询结束时单纯形顶点在两个形状中的下标。形状逐帧移动时
+ * 下标保持有效，下一次查询从旧单纯形出发，通常一两次迭代即可收敛。
+ */
+struct GjkCache {
+    std::size_t count = 0;          ///< 单纯形顶点数（0 表示缓存为空）
+    std::size_t index_a[4] = {};    ///< 单纯形顶点在形状 A 中的下标
+    std::size_t index_b[4] = {};    ///< 单纯形顶点在形状 B 中的下标
+};
+
+/**
+ * @brief GJK 距离查询结果
+ */
+struct GjkResult {
+    bool overlapping = false;   ///< 两形状是否重叠
+    float distance = 0.0f;      ///< 两形状之间的距离（重叠时为0）
+    Point closest_a;            ///< 形状 A 上的最近点（重叠时为两形状的一个公共点）
+    Point closest_b;            ///< 形状 B 上的最近点（重叠时与 closest_a 相同）
+    std::size_t iterations = 0; ///< 迭代次数
+};
+
+/**
+ * @brief EPA 穿透查询结果
+ *
+ * 将形状 A 沿 -normal 平移 depth 即可使两形状恰好接触。
+ */
+struct EpaResult {
+    Point normal;       ///< 穿透方向（单位向量，大致从 A 指向 B）
+    float depth = 0.0f; ///< 穿透深度
+    Point contact_a;    ///< 形状 A 上的接触点
+    Point contact_b;    ///< 形状 B 上的接触点
+};
+
+/**
+ * @brief 使用 GJK 算法计算两个凸形状之间的距离
+ * @param a 第一个凸形状
+ * @param b 第二个凸形状
+ * @param cache 热启动缓存（可为空），查询结束后写回最终单纯形
+ * @return 距离、最近点以及是否重叠
+ */
+[[nodiscard]] GjkResult gjk_distance(const ConvexShape& a, const ConvexShape& b, GjkCache* cache = nullptr);
+
+/**
+ * @brief 判断两个凸形状是否重叠
+ * @param a 第一个凸形状
+ * @param b 第二个凸形状
+ * @param cache 热启动缓存（可为空）
+ * @return 是否重叠
+ */
+[[nodiscard]] bool gjk_intersects(const ConvexShape& a, const ConvexShape& b, GjkCache* cache = nullptr);
+
+/**
+ * @brief 使用 EPA 算法计算两个重叠凸形状的穿透向量
+ * @param a 第一个凸形状
+ * @param b 第二个凸形状
+ * @param cache 热启动缓存（可为空），传递给内部的 GJK 查询
+ * @return 穿透信息（如果不重叠则返回std::nullopt）
+ * @note 两个形状都位于同一 z 平面时（例如由 Polygon 构造）使用2D扩展多边形
+ */
+[[nodiscard]] std::optional<EpaResult> epa_penetration(const ConvexShape& a, const ConvexShape& b, GjkCache* cache = nullptr);
+
+} // namespace utils
+} // namespace geometry
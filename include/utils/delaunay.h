@@ -0,0 +1,42 @@
+#pragma once
+
+#include "geometry/Point.h"
+#include "geometry/PolygonWithHoles.h"
+#include "geometry/Triangulation.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 计算2D点集的 Delaunay 三角剖分（随机增量 + Lawson 翻边）
+ * @param points 点集（只使用xy坐标）
+ * @param seed 有偏随机插入顺序（BRIO）所用的种子
+ * @return 三角剖分，points 与输入相同，三角形均为逆时针
+ * @note 每一轮插入的点按 Hilbert 曲线排序，点定位从上一个插入点附近开始行走，
+ *       期望时间复杂度 O(n log n)。凸包外部用虚拟三角形表示，因此不需要超级三角形。
+ *       重复点只有其中一个会出现在三角形中；所有点共线时返回不含三角形的结果。
+ */
+[[nodiscard]] Triangulation delaunay(const std::vector<Point>& points, std::uint32_t seed = 0);
+
+/**
+ * @brief 计算带洞多边形的约束 Delaunay 三角剖分，可选地加密为高质量网格
+ * @param polygon 带洞多边形（外边界与洞均为简单多边形，只使用xy坐标）
+ * @param min_angle 期望的最小内角（度），0 表示不加密；大于30度时按30度处理
+ * @param max_steiner 加密时最多新增的点数，0 表示自动取 16 * 顶点数 + 1024
+ * @return 只包含区域内部三角形的三角剖分：points 为去重后的边界顶点加上新增点，
+ *         三角形均为逆时针，边界边（外边界与洞的边）上 halfedges 为 -1
+ * @note 先对全部边界顶点做 Delaunay 三角剖分，再逐条恢复边界边（Sloan 翻边队列加
+ *       Lawson 翻边），最后从凸包外部出发按穿过边界的次数奇偶性剔除外部和洞内的三角形。
+ *       加密采用 Ruppert 算法：被侵占的边界边在中点分割，其余质量差的三角形在外心插入新点，
+ *       新点的 z 坐标线性插值得到。两条边界边之间的小于 min_angle 的输入角无法改善，
+ *       其附近的三角形会被保留；达到 max_steiner 后停止加密。
+ *       与其他边界相交的边界边无法恢复，会被跳过。
+ */
+[[nodiscard]] Triangulation constrained_delaunay(const PolygonWithHoles& polygon, float min_angle = 0.0f,
+                                                 std::size_t max_steiner = 0);
+
+} // namespace utils
+} // namespace geometry
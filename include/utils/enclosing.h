@@ -0,0 +1,39 @@
+#pragma once
+
+#include "geometry/Point.h"
+#include "geometry/Circle.h"
+#include "geometry/Sphere.h"
+#include <cstdint>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 计算2D点集的最小外接圆（迭代式 Welzl 算法，带移到队首启发）
+ * @param points 点集（只使用xy坐标）
+ * @param seed 随机打乱顺序所用的种子，相同种子得到相同的计算过程
+ * @return 最小外接圆（点集为空时返回半径为0的原点圆）
+ * @note 随机顺序下期望时间复杂度 O(n)；返回的半径向上取整，保证所有点都在圆内
+ */
+[[nodiscard]] Circle min_enclosing_circle(const std::vector<Point>& points, std::uint32_t seed = 0);
+
+/**
+ * @brief 计算3D点集的最小外接球（迭代式 Welzl 算法，带移到队首启发）
+ * @param points 点集
+ * @param seed 随机打乱顺序所用的种子
+ * @return 最小外接球（点集为空时返回半径为0的原点球）
+ * @note 随机顺序下期望时间复杂度 O(n)；返回的半径向上取整，保证所有点都在球内
+ */
+[[nodiscard]] Sphere min_enclosing_sphere(const std::vector<Point>& points, std::uint32_t seed = 0);
+
+/**
+ * @brief 用 Ritter 算法快速计算近似外接球
+ * @param points 点集
+ * @return 包含所有点的球（半径通常比最优值大 5%~20%）
+ * @note 只需对点集做三次线性扫描，适合不要求最优的粗略剔除
+ */
+[[nodiscard]] Sphere ritter_sphere(const std::vector<Point>& points);
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "geometry/ConvexPolyhedron.h"
+#include "geometry/Plane.h"
+#include "geometry/Sphere.h"
+#include <optional>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 计算一组半空间交集的最大内切球（Chebyshev 中心）
+ * @param planes 平面，每个平面保留正侧（法向量指向交集内部，与 ConvexVolume 相同）
+ * @return 最大内切球；交集为空或没有内部（退化为平面、直线或点）时返回 std::nullopt
+ * @note 求解4个变量的线性规划 max r s.t. n_i·c + d_i >= r：单纯形法只在少量平面组成的工作集上换基，
+ *       每轮把全部平面中违反最严重的一批加入工作集，全集只需扫描少数几遍。
+ *       为保证有界额外加入一个很大的包围盒，交集无界时结果落在包围盒上
+ */
+[[nodiscard]] std::optional<Sphere> inscribed_sphere(const std::vector<Plane>& planes);
+
+/**
+ * @brief 把一组半空间的交集转换为凸多面体网格
+ * @param planes 平面，每个平面保留正侧（法向量指向交集内部）
+ * @return 凸多面体；交集为空、没有内部或无界时返回 std::nullopt
+ * @note 先用 inscribed_sphere 求出内部点，平移到原点后每个平面对偶为一个点，
+ *       对偶点集的 Quickhull 凸包（期望 O(n log n)）的面对应多面体的顶点、顶点对应多面体的面。
+ *       顶点直接由对偶面在双精度下求得（比三平面克莱姆法则更稳定），多于三个平面交于同一顶点时会被合并。
+ *       冗余平面（不贡献面）不出现在 face_planes 中
+ */
+[[nodiscard]] std::optional<ConvexPolyhedron> halfspace_intersection(const std::vector<Plane>& planes);
+
+} // namespace utils
+} // namespace geometry
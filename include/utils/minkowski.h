@@ -0,0 +1,58 @@
+#pragma once
+
+#include "geometry/Point.h"
+#include "geometry/Polygon.h"
+#include "geometry/PolygonBuffer.h"
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 计算两个凸多边形的 Minkowski 和（旋转边合并，O(n+m)）
+ * @param a 第一个凸多边形（顺时针或逆时针均可）
+ * @param b 第二个凸多边形（顺时针或逆时针均可）
+ * @param out 输出多边形（逆时针），复用其已分配的顶点容量
+ * @note 输入必须是凸多边形，非凸输入请使用 minkowski_sum
+ */
+void minkowski_sum_convex(const Polygon& a, const Polygon& b, Polygon& out);
+
+/**
+ * @brief 计算两个凸多边形的 Minkowski 和
+ * @param a 第一个凸多边形
+ * @param b 第二个凸多边形
+ * @return Minkowski 和（逆时针凸多边形）
+ */
+[[nodiscard]] Polygon minkowski_sum_convex(const Polygon& a, const Polygon& b);
+
+/**
+ * @brief 将简单多边形分解为凸多边形（耳切三角化 + Hertel-Mehlhorn 合并）
+ * @param polygon 简单多边形（不自交）
+ * @return 凸多边形列表（逆时针），其并集等于原多边形
+ * @note 分解出的凸块数量不超过最优值的4倍
+ */
+[[nodiscard]] std::vector<Polygon> convex_decomposition(const Polygon& polygon);
+
+/**
+ * @brief 计算任意简单多边形的 Minkowski 和
+ * @param a 第一个多边形
+ * @param b 第二个多边形
+ * @param out 输出缓冲区（先清空再写入），复用其容量
+ *
+ * 两者都是凸多边形时输出一个多边形；否则先做凸分解，输出所有凸块两两
+ * 之和，这些凸多边形的并集即为 Minkowski 和。
+ */
+void minkowski_sum(const Polygon& a, const Polygon& b, PolygonBuffer& out);
+
+/**
+ * @brief 计算两组已分解凸块的 Minkowski 和
+ * @param a_parts 第一个多边形的凸分解
+ * @param b_parts 第二个多边形的凸分解
+ * @param out 输出缓冲区（先清空再写入），复用其容量
+ * @note 当同一个形状要与大量障碍物求和时，预先分解一次即可重复使用
+ */
+void minkowski_sum(const std::vector<Polygon>& a_parts, const std::vector<Polygon>& b_parts,
+                   PolygonBuffer& out);
+
+} // namespace utils
+} // namespace geometry
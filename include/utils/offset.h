@@ -0,0 +1,51 @@
+#pragma once
+
+#include "geometry/Point.h"
+#include "geometry/Polygon.h"
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 偏移时凸角处的连接方式
+ */
+enum class JoinType {
+    Miter,  ///< 尖角（超过斜接限制时退化为方角）
+    Round,  ///< 圆角
+    Square  ///< 方角
+};
+
+/**
+ * @brief 将多边形向外扩张或向内收缩指定距离
+ * @param polygon 简单多边形（顺时针或逆时针均可）
+ * @param delta 偏移距离（正值扩张，负值收缩）
+ * @param join 凸角的连接方式
+ * @param miter_limit 斜接限制（尖角长度与偏移距离之比的上限）
+ * @param arc_tolerance 圆角的最大弦高误差（0 表示取 |delta| 的 0.5%）
+ * @return 偏移结果，逆时针多边形为外轮廓，顺时针多边形为孔洞
+ * @note 原始偏移曲线在自交点处拆分成若干环，只保留正绕数区域的边界，
+ *       因此收缩时消失的部分和凹角处的反向小环都会被清除
+ */
+[[nodiscard]] std::vector<Polygon> offset_polygon(const Polygon& polygon, float delta,
+                                                  JoinType join = JoinType::Miter,
+                                                  float miter_limit = 2.0f,
+                                                  float arc_tolerance = 0.0f);
+
+/**
+ * @brief 并行偏移一整层多边形
+ * @param polygons 多边形列表
+ * @param delta 偏移距离（正值扩张，负值收缩）
+ * @param join 凸角的连接方式
+ * @param miter_limit 斜接限制
+ * @param arc_tolerance 圆角的最大弦高误差（0 表示取 |delta| 的 0.5%）
+ * @return 与输入一一对应的偏移结果
+ */
+[[nodiscard]] std::vector<std::vector<Polygon>> offset_polygons(const std::vector<Polygon>& polygons,
+                                                                float delta,
+                                                                JoinType join = JoinType::Miter,
+                                                                float miter_limit = 2.0f,
+                                                                float arc_tolerance = 0.0f);
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 获取可用的硬件线程数
+ * @return 线程数（至少为1）
+ */
+[[nodiscard]] inline std::size_t hardware_threads() noexcept {
+    const unsigned int count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : static_cast<std::size_t>(count);
+}
+
+/**
+ * @brief 把区间 [0, count) 切成连续的块并在多个线程上并行处理
+ * @param count 元素总数
+ * @param body 处理函数，签名为 void(std::size_t begin, std::size_t end)
+ * @param min_chunk 每个线程至少处理的元素数，任务太小时直接在当前线程执行
+ *
+ * 各块互不重叠，body 只需保证对不同区间的写入互不干扰。
+ * 工作线程抛出的第一个异常会在所有线程结束后重新抛出。
+ */
+template <typename Function>
+void parallel_for(std::size_t count, Function&& body, std::size_t min_chunk = 1024) {
+    if (count == 0) {
+        return;
+    }
+
+    const std::size_t max_threads = (count + min_chunk - 1) / std::max<std::size_t>(min_chunk, 1);
+    const std::size_t thread_count = std::min(hardware_threads(), std::max<std::size_t>(max_threads, 1));
+    if (thread_count <= 1) {
+        body(std::size_t{0}, count);
+        return;
+    }
+
+    const std::size_t chunk = (count + thread_count - 1) / thread_count;
+    std::vector<std::thread> workers;
+    std::vector<std::exception_ptr> errors(thread_count);
+    workers.reserve(thread_count - 1);
+
+    for (std::size_t t = 1; t < thread_count; ++t) {
+        const std::size_t begin = t * chunk;
+        const std::size_t end = std::min(count, begin + chunk);
+        if (begin >= end) {
+            break;
+        }
+        workers.emplace_back([&body, &errors, t, begin, end]() {
+            try {
+                body(begin, end);
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        });
+    }
+
+    try {
+        body(std::size_t{0}, std::min(count, chunk));
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/**
+ * @brief 并行排序
+ * @param first 起始迭代器（随机访问）
+ * @param last 结束迭代器
+ * @param comp 比较函数
+ * @param min_chunk 每个线程至少排序的元素数，元素太少时退化为 std::sort
+ *
+ * 先把区间切成若干块并行排序，再逐轮两两并行归并。结果与 std::sort 一样
+ * 不保证相等元素的相对顺序。
+ */
+template <typename RandomIt, typename Compare = std::less<>>
+void parallel_sort(RandomIt first, RandomIt last, Compare comp = Compare{}, std::size_t min_chunk = 1 << 14) {
+    const std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+    const std::size_t chunks = std::min(hardware_threads(), count / std::max<std::size_t>(min_chunk, 1));
+    if (chunks <= 1) {
+        std::sort(first, last, comp);
+        return;
+    }
+
+    std::vector<std::size_t> bounds(chunks + 1);
+    for (std::size_t c = 0; c <= chunks; ++c) {
+        bounds[c] = count * c / chunks;
+    }
+    const auto at = [first](std::size_t offset) {
+        return first + static_cast<typename std::iterator_traits<RandomIt>::difference_type>(offset);
+    };
+
+    parallel_for(chunks, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c) {
+            std::sort(at(bounds[c]), at(bounds[c + 1]), comp);
+        }
+    }, 1);
+
+    for (std::size_t width = 1; width < chunks; width *= 2) {
+        const std::size_t merges = (chunks + 2 * width - 1) / (2 * width);
+        parallel_for(merges, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t m = begin; m < end; ++m) {
+                const std::size_t lo = m * 2 * width;
+                const std::size_t mid = std::min(lo + width, chunks);
+                const std::size_t hi = std::min(lo + 2 * width, chunks);
+                if (mid < hi) {
+                    std::inplace_merge(at(bounds[lo]), at(bounds[mid]), at(bounds[hi]), comp);
+                }
+            }
+        }, 1);
+    }
+}
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "geometry/Point.h"
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 几何谓词的求值策略
+ */
+enum class PredicatePolicy {
+    Epsilon, ///< 旧行为：float 叉积加固定容差，接近退化时结果不可靠
+    Exact    ///< 自适应精度：先做带误差界的浮点过滤，无法确定符号时依次用区间算术和精确算术
+};
+
+/**
+ * @brief 设置全局谓词策略（默认 Exact）
+ * @param policy 新策略
+ * @note 影响 Line::intersects、Polygon::is_convex 与 Polygon::convex_hull；
+ *       Delaunay 系列算法总是使用精确谓词
+ */
+void set_predicate_policy(PredicatePolicy policy) noexcept;
+
+/**
+ * @brief 获取当前的全局谓词策略
+ * @return 当前策略
+ */
+[[nodiscard]] PredicatePolicy predicate_policy() noexcept;
+
+/**
+ * @brief 2D 方向测试
+ * @return 正值表示 a, b, c 逆时针，负值表示顺时针，0 表示三点精确共线
+ * @note 符号总是精确的；数值在过滤通过时为行列式的近似值
+ */
+[[nodiscard]] double orient2d(double ax, double ay, double bx, double by, double cx, double cy) noexcept;
+
+/**
+ * @brief 2D 方向测试（只使用xy坐标）
+ */
+[[nodiscard]] double orient2d(const Point& a, const Point& b, const Point& c) noexcept;
+
+/**
+ * @brief 3D 方向测试
+ * @return 正值表示 d 位于平面 abc 下方（从上方看 a, b, c 逆时针），负值表示上方，0 表示四点精确共面
+ */
+[[nodiscard]] double orient3d(const Point& a, const Point& b, const Point& c, const Point& d) noexcept;
+
+/**
+ * @brief 2D 共圆测试
+ * @return 当 a, b, c 逆时针时，正值表示 d 在外接圆内，负值表示在圆外，0 表示四点精确共圆
+ */
+[[nodiscard]] double incircle(double ax, double ay, double bx, double by, double cx, double cy,
+                              double dx, double dy) noexcept;
+
+/**
+ * @brief 2D 共圆测试（只使用xy坐标）
+ */
+[[nodiscard]] double incircle(const Point& a, const Point& b, const Point& c, const Point& d) noexcept;
+
+/**
+ * @brief 单个谓词在各求值阶段确定符号的次数
+ */
+struct PredicateCounters {
+    std::uint64_t filter_hits = 0;       ///< 浮点过滤（误差界）直接确定符号
+    std::uint64_t interval_hits = 0;     ///< 过滤失败后由区间算术确定符号
+    std::uint64_t exact_evaluations = 0; ///< 区间仍包含0，转入展开式精确算术
+
+    /**
+     * @brief 调用总次数
+     */
+    [[nodiscard]] std::uint64_t calls() const noexcept {
+        return filter_hits + interval_hits + exact_evaluations;
+    }
+
+    /**
+     * @brief 过滤失败（进入区间或精确阶段）的比例
+     * @return [0, 1]，没有调用时为 0
+     */
+    [[nodiscard]] double escalation_rate() const noexcept {
+        const std::uint64_t total = calls();
+        return total == 0 ? 0.0 : static_cast<double>(interval_hits + exact_evaluations) / total;
+    }
+};
+
+/**
+ * @brief 三个谓词的统计
+ */
+struct PredicateStats {
+    PredicateCounters orient2d;
+    PredicateCounters orient3d;
+    PredicateCounters incircle;
+};
+
+/**
+ * @brief 开启或关闭谓词统计（默认关闭）
+ * @param enabled 是否统计
+ * @note 关闭时快速路径只多一次 relaxed 原子读；开启后每次调用做一次原子加，多线程下有竞争开销，
+ *       只建议在调优数据集时打开
+ */
+void set_predicate_stats_enabled(bool enabled) noexcept;
+
+/**
+ * @brief 谓词统计是否开启
+ */
+[[nodiscard]] bool predicate_stats_enabled() noexcept;
+
+/**
+ * @brief 获取自上次清零以来的统计（所有线程合计）
+ * @return 统计快照
+ */
+[[nodiscard]] PredicateStats predicate_stats() noexcept;
+
+/**
+ * @brief 把统计清零
+ */
+void reset_predicate_stats() noexcept;
+
+namespace detail {
+
+// Shewchuk 的第一级误差界，epsilon 为 double 的单位舍入 2^-53
+constexpr double kEpsilon = 1.0 / 9007199254740992.0;
+constexpr double kCcwErrBound = (3.0 + 16.0 * kEpsilon) * kEpsilon;
+constexpr double kO3dErrBound = (7.0 + 56.0 * kEpsilon) * kEpsilon;
+constexpr double kIccErrBound = (10.0 + 96.0 * kEpsilon) * kEpsilon;
+
+// float 精度下的同一误差界，epsilon 为 2^-24；乘积和小于 kFloatFilterMin 时可能出现非规格化数
+constexpr float kEpsilonFloat = 1.0f / 16777216.0f;
+constexpr float kCcwErrBoundFloat = (3.0f + 16.0f * kEpsilonFloat) * kEpsilonFloat;
+constexpr float kFloatFilterMin = 1e-30f;
+
+enum Counter { kOrient2d, kOrient3d, kIncircle, kCounterCount };
+
+inline std::atomic<bool> g_stats_enabled{false};
+inline std::atomic<std::uint64_t> g_filter_hits[kCounterCount] = {};
+
+inline void count_filter_hit(Counter counter) noexcept {
+    if (g_stats_enabled.load(std::memory_order_relaxed)) {
+        g_filter_hits[counter].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// 过滤失败时的后续阶段：先做区间算术，区间仍包含0时再用展开式精确求值；返回值的符号精确
+[[nodiscard]] double orient2d_adapt(double ax, double ay, double bx, double by, double cx, double cy) noexcept;
+[[nodiscard]] double orient3d_adapt(const Point& a, const Point& b, const Point& c, const Point& d) noexcept;
+[[nodiscard]] double incircle_adapt(double ax, double ay, double bx, double by, double cx, double cy, double dx,
+                                    double dy) noexcept;
+
+} // namespace detail
+
+// ===== 实现：浮点过滤内联，只有无法确定符号时才调用后续阶段 =====
+
+inline double orient2d(double ax, double ay, double bx, double by, double cx, double cy) noexcept {
+    const double detleft = (ax - cx) * (by - cy);
+    const double detright = (ay - cy) * (bx - cx);
+    const double det = detleft - detright;
+
+    // 与 Shewchuk 的第一级过滤等价，但不按 detleft/detright 的符号分支，随机数据上分支预测更稳定
+    const double errbound = detail::kCcwErrBound * (std::abs(detleft) + std::abs(detright));
+    if (std::abs(det) >= errbound) {
+        detail::count_filter_hit(detail::kOrient2d);
+        return det;
+    }
+    return detail::orient2d_adapt(ax, ay, bx, by, cx, cy);
+}
+
+inline double orient2d(const Point& a, const Point& b, const Point& c) noexcept {
+    // 坐标本身是 float，先在 float 精度下过滤；乘积接近下溢时误差界不成立，交给 double 过滤
+    const float detleft = (a.x - c.x) * (b.y - c.y);
+    const float detright = (a.y - c.y) * (b.x - c.x);
+    const float det = detleft - detright;
+    const float detsum = std::abs(detleft) + std::abs(detright);
+    if (std::abs(det) >= detail::kCcwErrBoundFloat * detsum && detsum >= detail::kFloatFilterMin) {
+        detail::count_filter_hit(detail::kOrient2d);
+        return det;
+    }
+    return orient2d(a.x, a.y, b.x, b.y, c.x, c.y);
+}
+
+inline double orient3d(const Point& a, const Point& b, const Point& c, const Point& d) noexcept {
+    const double adx = static_cast<double>(a.x) - d.x, ady = static_cast<double>(a.y) - d.y;
+    const double adz = static_cast<double>(a.z) - d.z;
+    const double bdx = static_cast<double>(b.x) - d.x, bdy = static_cast<double>(b.y) - d.y;
+    const double bdz = static_cast<double>(b.z) - d.z;
+    const double cdx = static_cast<double>(c.x) - d.x, cdy = static_cast<double>(c.y) - d.y;
+    const double cdz = static_cast<double>(c.z) - d.z;
+
+    const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    const double cdxady = cdx * ady, adxcdy = adx * cdy;
+    const double adxbdy = adx * bdy, bdxady = bdx * ady;
+
+    const double det = adz * (bdxcdy - cdxbdy) + bdz * (cdxady - adxcdy) + cdz * (adxbdy - bdxady);
+    const double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * std::abs(adz)
+                             + (std::abs(cdxady) + std::abs(adxcdy)) * std::abs(bdz)
+                             + (std::abs(adxbdy) + std::abs(bdxady)) * std::abs(cdz);
+    const double errbound = detail::kO3dErrBound * permanent;
+    if (det > errbound || -det > errbound) {
+        detail::count_filter_hit(detail::kOrient3d);
+        return det;
+    }
+    return detail::orient3d_adapt(a, b, c, d);
+}
+
+inline double incircle(double ax, double ay, double bx, double by, double cx, double cy, double dx,
+                       double dy) noexcept {
+    const double adx = ax - dx, ady = ay - dy;
+    const double bdx = bx - dx, bdy = by - dy;
+    const double cdx = cx - dx, cdy = cy - dy;
+
+    const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    const double alift = adx * adx + ady * ady;
+    const double cdxady = cdx * ady, adxcdy = adx * cdy;
+    const double blift = bdx * bdx + bdy * bdy;
+    const double adxbdy = adx * bdy, bdxady = bdx * ady;
+    const double clift = cdx * cdx + cdy * cdy;
+
+    const double det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+    const double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * alift
+                             + (std::abs(cdxady) + std::abs(adxcdy)) * blift
+                             + (std::abs(adxbdy) + std::abs(bdxady)) * clift;
+    const double errbound = detail::kIccErrBound * permanent;
+    if (det > errbound || -det > errbound) {
+        detail::count_filter_hit(detail::kIncircle);
+        return det;
+    }
+    return detail::incircle_adapt(ax, ay, bx, by, cx, cy, dx, dy);
+}
+
+inline double incircle(const Point& a, const Point& b, const Point& c, const Point& d) noexcept {
+    return incircle(a.x, a.y, b.x, b.y, c.x, c.y, d.x, d.y);
+}
+
+} // namespace utils
+} // namespace geometry
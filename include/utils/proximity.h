@@ -0,0 +1,118 @@
+#pragma once
+
+#include "geometry/Point.h"
+#include "geometry/Line.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 最近点对查询的结果
+ */
+struct ClosestPair {
+    std::size_t first = 0;  ///< 第一个点在输入中的下标
+    std::size_t second = 0; ///< 第二个点在输入中的下标
+    float distance = 0.0f;  ///< 两点之间的距离
+};
+
+/**
+ * @brief 单个点的最近邻
+ */
+struct NearestNeighbor {
+    std::size_t index = 0; ///< 最近邻在输入中的下标
+    float distance = 0.0f; ///< 到最近邻的距离
+};
+
+/**
+ * @brief 求3D点集中距离最近的两个点（随机增量网格哈希算法）
+ * @param points 点集
+ * @param seed 随机插入顺序所用的种子
+ * @return 最近点对（first < second）
+ * @throws std::invalid_argument 如果点数少于2
+ * @note 期望时间复杂度 O(n)；遇到重合点时立即返回距离为0的点对
+ */
+[[nodiscard]] ClosestPair closest_pair(const std::vector<Point>& points, std::uint32_t seed = 0);
+
+/**
+ * @brief 批量求每个点的最近邻（不含自身）
+ * @param points 点集
+ * @return 与输入一一对应的最近邻列表
+ * @throws std::invalid_argument 如果点数少于2
+ * @note 点按中位数划分建成 k-d 树（划分位置取决于数据分布，聚集点与离群点混合时也不会退化），
+ *       每个点从所在叶子向上搜索；按叶子顺序分块在多个线程上并行执行，总复杂度 O(n log n)
+ */
+[[nodiscard]] std::vector<NearestNeighbor> all_nearest_neighbors(const std::vector<Point>& points);
+
+/**
+ * @brief 两条线段之间的最近点
+ */
+struct SegmentClosestPoints {
+    Point first;           ///< 第一条线段上的最近点 first.start + s * (first.end - first.start)
+    Point second;          ///< 第二条线段上的最近点 second.start + t * (second.end - second.start)
+    float s = 0.0f;        ///< 第一条线段上的参数 [0, 1]
+    float t = 0.0f;        ///< 第二条线段上的参数 [0, 1]
+    float distance = 0.0f; ///< 两个最近点之间的距离
+};
+
+/**
+ * @brief 三角形上离给定点最近的点
+ *
+ * 最近点为 (1 - u - v) * a + u * b + v * c，与 RayTriangleHit 的重心坐标约定相同。
+ */
+struct TriangleClosestPoint {
+    Point point;           ///< 三角形上的最近点
+    float u = 0.0f;        ///< 顶点 b 的重心坐标
+    float v = 0.0f;        ///< 顶点 c 的重心坐标
+    float distance = 0.0f; ///< 到最近点的距离
+};
+
+/**
+ * @brief 求3D中两条线段之间的最近点
+ * @param first 第一条线段
+ * @param second 第二条线段
+ * @return 最近点及其参数；平行或重叠时返回其中一组最近点
+ * @note 与 distance(Line, Line) 按无限长直线计算不同，这里把参数限制在线段范围内；
+ *       退化为点的线段也能正确处理。内部用双精度计算
+ */
+[[nodiscard]] SegmentClosestPoints segment_closest_points(const Line& first, const Line& second) noexcept;
+
+/**
+ * @brief 求三角形上离给定点最近的点
+ * @param point 查询点
+ * @param a 三角形顶点
+ * @param b 三角形顶点
+ * @param c 三角形顶点
+ * @return 最近点及其重心坐标
+ * @note 按顶点、边、面的 Voronoi 区域分类，不需要先求三角形平面；
+ *       三角形退化（三点共线）时取三条边上的最近点。内部用双精度计算
+ */
+[[nodiscard]] TriangleClosestPoint triangle_closest_point(const Point& point, const Point& a, const Point& b,
+                                                          const Point& c) noexcept;
+
+/**
+ * @brief 批量求线段对之间的最近点
+ * @param first 第一组线段
+ * @param second 第二组线段（与 first 一一配对）
+ * @param count 线段对数
+ * @param out 输出数组（至少 count 个元素），out[i] 与 segment_closest_points(first[i], second[i]) 相同
+ * @note 线段对较多时分块在多个线程上计算
+ */
+void segment_closest_points(const Line* first, const Line* second, std::size_t count, SegmentClosestPoints* out);
+
+/**
+ * @brief 批量求点到三角形的最近点
+ * @param points 查询点
+ * @param corners 三角形顶点，每三个一组，第 i 组与 points[i] 配对
+ * @param count 查询数
+ * @param out 输出数组（至少 count 个元素），
+ *            out[i] 与 triangle_closest_point(points[i], corners[3i], corners[3i+1], corners[3i+2]) 相同
+ * @note 查询较多时分块在多个线程上计算
+ */
+void triangle_closest_points(const Point* points, const Point* corners, std::size_t count,
+                             TriangleClosestPoint* out);
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "geometry/Point.h"
+#include "geometry/Plane.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief RANSAC 平面检测的参数
+ */
+struct PlaneDetectionOptions {
+    float threshold = 0.01f;            ///< 内点到平面的最大距离
+    std::size_t min_inliers = 50;       ///< 接受一个平面所需的最少内点数，低于它时停止检测
+    std::size_t max_planes = 16;        ///< 最多检测的平面数
+    std::size_t max_iterations = 2000;  ///< 每个平面最多尝试的假设数
+    double confidence = 0.99;           ///< 至少抽到一次全内点样本的概率，达到后提前终止
+    std::uint32_t seed = 0;             ///< 随机抽样的种子，相同种子得到相同结果
+};
+
+/**
+ * @brief 检测到的一个平面
+ */
+struct DetectedPlane {
+    Plane plane;                        ///< 用全部内点最小二乘拟合后的平面
+    std::vector<std::uint32_t> inliers; ///< 内点在输入中的下标（升序）
+};
+
+/**
+ * @brief 用 RANSAC 从含噪声的点云中依次检测多个平面
+ * @param points 点云
+ * @param options 检测参数
+ * @return 按检测顺序排列的平面（内点数通常递减），每个点最多属于一个平面
+ * @throws std::invalid_argument 如果 threshold 不是正数或 confidence 不在 (0, 1) 内
+ * @throws std::length_error 如果点数超过 uint32 下标范围
+ * @note 每一轮并行评估固定数量（与线程数无关）的一批假设，内点用 Plane::signed_distances 分块批量计数，
+ *       已不可能超过当前最优的假设中途放弃；按当前最优内点比例估计所需的假设数，达到后提前终止。
+ *       接受一个平面后用 Plane::fit 对其内点重新拟合，移除这些点再检测下一个平面
+ */
+[[nodiscard]] std::vector<DetectedPlane> detect_planes(const std::vector<Point>& points,
+                                                       const PlaneDetectionOptions& options = {});
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "geometry/Point.h"
+#include "geometry/Line.h"
+#include "utils/utils.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/// 射线没有命中任何图元时写入的下标
+constexpr std::uint32_t kNoHit = 0xFFFFFFFFu;
+
+/**
+ * @brief SoA 形式存储的一批射线 origin + t * direction
+ *
+ * 方向不要求是单位向量，命中参数 t 以 direction 的长度为单位；方向为单位向量时 t 就是距离。
+ */
+struct RayBatch {
+    std::vector<float> ox, oy, oz; ///< 起点坐标
+    std::vector<float> dx, dy, dz; ///< 方向分量
+
+    RayBatch() = default;
+
+    /**
+     * @brief 从线段列表构造：起点为 start，方向为 end - start（t = 1 对应 end）
+     * @param lines 线段
+     */
+    explicit RayBatch(const std::vector<Line>& lines);
+
+    /**
+     * @brief 追加一条射线
+     * @param origin 起点
+     * @param direction 方向
+     */
+    void push_back(const Point& origin, const Point& direction);
+
+    /**
+     * @brief 追加一条线段，起点为 start，方向为 end - start
+     * @param line 线段
+     */
+    void push_back(const Line& line);
+
+    /**
+     * @brief 射线数量
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @brief 预留容量
+     * @param count 射线数
+     */
+    void reserve(std::size_t count);
+};
+
+/**
+ * @brief 批量计算每条射线与每个平面的交点参数
+ * @param rays 射线
+ * @param planes SoA 平面系数
+ * @param t_out 输出数组（至少 rays.size() * planes.size() 个元素），按平面优先排列：
+ *              t_out[p * rays.size() + r] 为射线 r 与平面 p 的交点参数，不相交时为 +inf
+ * @param t_min 有效参数区间下界
+ * @param t_max 有效参数区间上界（线段求交时取1）
+ * @return 命中的（射线, 平面）对数
+ * @note 方向与法向量点积的绝对值小于 1e-6 时视为平行，与 Plane::intersection_with 的判断一致。
+ *       启用 SSE2 时一次处理4条射线，射线较多时分块在多个线程上计算
+ */
+std::size_t ray_plane_hits(const RayBatch& rays, const PlaneCoefficients& planes, float* t_out, float t_min = 0.0f,
+                           float t_max = std::numeric_limits<float>::infinity());
+
+/**
+ * @brief 批量求每条射线最近命中的平面
+ * @param rays 射线
+ * @param planes SoA 平面系数
+ * @param t_out 输出数组（至少 rays.size() 个元素），最近交点的参数，没有命中时为 +inf
+ * @param plane_out 输出数组（至少 rays.size() 个元素），最近命中的平面下标，没有命中时为 kNoHit；
+ *                  参数相同时取下标较小的平面
+ * @param t_min 有效参数区间下界
+ * @param t_max 有效参数区间上界
+ * @return 至少命中一个平面的射线数
+ * @note 与 ray_plane_hits 逐项求最小值的结果完全相同，但不需要 rays.size() * planes.size() 的中间数组；
+ *       最近值保存在寄存器中，每组4条射线只遍历一次平面
+ */
+std::size_t closest_ray_plane_hits(const RayBatch& rays, const PlaneCoefficients& planes, float* t_out,
+                                   std::uint32_t* plane_out, float t_min = 0.0f,
+                                   float t_max = std::numeric_limits<float>::infinity());
+
+/**
+ * @brief 射线与三角形的交点
+ *
+ * 交点为 (1 - u - v) * a + u * b + v * c，也等于 origin + t * direction。
+ */
+struct RayTriangleHit {
+    float t = 0.0f; ///< 射线参数
+    float u = 0.0f; ///< 顶点 b 的重心坐标
+    float v = 0.0f; ///< 顶点 c 的重心坐标
+};
+
+/**
+ * @brief Möller–Trumbore 射线-三角形求交（双面）
+ * @param origin 射线起点
+ * @param direction 射线方向（不要求单位长度）
+ * @param a 三角形顶点
+ * @param b 三角形顶点
+ * @param c 三角形顶点
+ * @param t_min 有效参数区间下界
+ * @param t_max 有效参数区间上界
+ * @return 交点；不相交、射线与三角形平行或三角形退化时返回 std::nullopt
+ * @note 不需要预先计算三角形平面，速度快；但射线恰好穿过相邻三角形的公共边时，
+ *       舍入误差可能使两个三角形都判为不相交，需要严格不漏检时使用 ray_triangle_watertight
+ */
+[[nodiscard]] std::optional<RayTriangleHit> ray_triangle(const Point& origin, const Point& direction, const Point& a,
+                                                         const Point& b, const Point& c, float t_min = 0.0f,
+                                                         float t_max = std::numeric_limits<float>::infinity()) noexcept;
+
+/**
+ * @brief 水密的射线-三角形求交（Woop–Benthin–Wald，双面）
+ * @param origin 射线起点
+ * @param direction 射线方向（不要求单位长度）
+ * @param a 三角形顶点
+ * @param b 三角形顶点
+ * @param c 三角形顶点
+ * @param t_min 有效参数区间下界
+ * @param t_max 有效参数区间上界
+ * @return 交点；不相交或三角形退化时返回 std::nullopt
+ * @note 把射线变换到 +z 轴上后用2D边函数判断，相邻三角形在公共边上算出的边函数只差一个符号，
+ *       穿过公共边或公共顶点的射线至少命中其中一个三角形；边函数恰好为0时改用双精度重新计算
+ */
+[[nodiscard]] std::optional<RayTriangleHit> ray_triangle_watertight(const Point& origin, const Point& direction,
+                                                                    const Point& a, const Point& b, const Point& c,
+                                                                    float t_min = 0.0f,
+                                                                    float t_max = std::numeric_limits<float>::infinity()) noexcept;
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "geometry/Plane.h"
+#include "geometry/Polygon.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 网格被一个平面切出的一层
+ */
+struct SliceLayer {
+    std::vector<Polygon> contours;  ///< 闭合轮廓（顶点在平面上；从第一个平面的法向量方向看，实体外边界逆时针、孔顺时针）
+    std::size_t open_chains = 0;    ///< 无法闭合而被丢弃的折线数，非零说明网格在这一层不封闭
+};
+
+/**
+ * @brief 用一组平行平面切割索引三角网格
+ * @param vertices 顶点坐标
+ * @param triangles 三角形顶点下标（每三个一组，从外部看逆时针）
+ * @param planes 平行平面（法向量可以同向或反向，顺序任意）
+ * @return 与 planes 一一对应的切片层
+ * @throws std::invalid_argument 如果平面不平行或三角形下标数量不是3的倍数
+ * @throws std::out_of_range 如果三角形下标越界
+ * @note 三角形按沿法向量的高度区间排序后扫描，每个三角形只被穿过它的平面处理；
+ *       层被切成连续的块在多个线程上并行计算。恰好落在平面上的顶点视为位于平面上方，
+ *       因此共面的面不产生线段，轮廓仍然闭合。线段按所在网格边拼接，要求网格是封闭的流形。
+ */
+[[nodiscard]] std::vector<SliceLayer> slice_mesh(const std::vector<Point>& vertices,
+                                                 const std::vector<std::uint32_t>& triangles,
+                                                 const std::vector<Plane>& planes);
+
+/**
+ * @brief 用一组平行平面切割三角形汤
+ * @param soup 三角形顶点（每三个点一个三角形，从外部看逆时针）
+ * @param planes 平行平面
+ * @return 与 planes 一一对应的切片层
+ * @throws std::invalid_argument 如果平面不平行或点数不是3的倍数
+ * @note 先把坐标完全相同的顶点合并成索引网格，再调用 slice_mesh
+ */
+[[nodiscard]] std::vector<SliceLayer> slice_mesh(const std::vector<Point>& soup, const std::vector<Plane>& planes);
+
+} // namespace utils
+} // namespace geometry
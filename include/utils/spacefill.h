@@ -0,0 +1,97 @@
+#pragma once
+
+#include "geometry/Point.h"
+#include "geometry/Polygon.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 空间填充曲线类型
+ */
+enum class CurveType {
+    Morton,  ///< Z 序曲线，编码最快
+    Hilbert  ///< Hilbert 曲线，相邻编码在空间上总是相邻，局部性更好
+};
+
+/**
+ * @brief 计算2D Morton 编码（按位交错）
+ * @param x 横坐标（32位整数）
+ * @param y 纵坐标（32位整数）
+ * @return 64位编码
+ * @note 编译时启用 BMI2（例如 -mbmi2 或 -march=native）会使用 PDEP 指令
+ */
+[[nodiscard]] std::uint64_t morton_encode_2d(std::uint32_t x, std::uint32_t y) noexcept;
+
+/**
+ * @brief 计算3D Morton 编码
+ * @param x 横坐标（只使用低21位）
+ * @param y 纵坐标（只使用低21位）
+ * @param z 竖坐标（只使用低21位）
+ * @return 63位编码
+ */
+[[nodiscard]] std::uint64_t morton_encode_3d(std::uint32_t x, std::uint32_t y, std::uint32_t z) noexcept;
+
+/**
+ * @brief 计算2D Hilbert 编码
+ * @param x 横坐标（32位整数）
+ * @param y 纵坐标（32位整数）
+ * @return 64位编码
+ */
+[[nodiscard]] std::uint64_t hilbert_encode_2d(std::uint32_t x, std::uint32_t y) noexcept;
+
+/**
+ * @brief 计算3D Hilbert 编码
+ * @param x 横坐标（只使用低21位）
+ * @param y 纵坐标（只使用低21位）
+ * @param z 竖坐标（只使用低21位）
+ * @return 63位编码
+ */
+[[nodiscard]] std::uint64_t hilbert_encode_3d(std::uint32_t x, std::uint32_t y, std::uint32_t z) noexcept;
+
+/**
+ * @brief 把点集量化到包围盒内的整数网格并计算曲线编码
+ * @param points 点集
+ * @param type 曲线类型
+ * @param dimensions 2 表示只使用xy坐标，3 表示使用xyz坐标
+ * @return 与输入一一对应的编码
+ * @throws std::invalid_argument 如果 dimensions 不是2或3
+ * @note 各轴使用相同的缩放比例，编码在多个线程上并行计算
+ */
+[[nodiscard]] std::vector<std::uint64_t> curve_codes(const std::vector<Point>& points,
+                                                     CurveType type = CurveType::Hilbert, int dimensions = 3);
+
+/**
+ * @brief 计算按曲线顺序排列点集的置换
+ * @param points 点集
+ * @param type 曲线类型
+ * @param dimensions 2 或 3
+ * @return 下标序列，order[k] 为排在第 k 位的点在输入中的下标
+ * @throws std::invalid_argument 如果 dimensions 不是2或3
+ */
+[[nodiscard]] std::vector<std::size_t> curve_order(const std::vector<Point>& points,
+                                                   CurveType type = CurveType::Hilbert, int dimensions = 3);
+
+/**
+ * @brief 按曲线顺序原地重排点集
+ * @param points 点集
+ * @param type 曲线类型
+ * @param dimensions 2 或 3
+ * @throws std::invalid_argument 如果 dimensions 不是2或3
+ */
+void sort_by_curve(std::vector<Point>& points, CurveType type = CurveType::Hilbert, int dimensions = 3);
+
+/**
+ * @brief 按包围盒中心的曲线顺序原地重排多边形集合
+ * @param polygons 多边形集合
+ * @param type 曲线类型
+ * @param dimensions 2 或 3
+ * @throws std::invalid_argument 如果 dimensions 不是2或3
+ */
+void sort_by_curve(std::vector<Polygon>& polygons, CurveType type = CurveType::Hilbert, int dimensions = 3);
+
+} // namespace utils
+} // namespace geometry
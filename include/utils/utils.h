@@ -4,6 +4,8 @@
 #include "geometry/Line.h"
 #include "geometry/Plane.h"
 #include "geometry/Polygon.h"
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <optional>
 #include <cmath>
@@ -40,6 +42,7 @@ namespace utils {
  * @param line1 第一条直线
  * @param line2 第二条直线
  * @return 最短距离
+ * @note 按无限长直线计算；线段之间的距离与最近点见 segment_closest_points（utils/proximity.h）
  */
 [[nodiscard]] float distance(const Line& line1, const Line& line2) noexcept;
 
@@ -76,6 +79,52 @@ namespace utils {
  */
 [[nodiscard]] std::optional<Point> intersection(const Plane& plane1, const Plane& plane2, const Plane& plane3) noexcept;
 
+/**
+ * @brief SoA 形式存储的平面方程系数 ax + by + cz + d = 0
+ */
+struct PlaneCoefficients {
+    std::vector<float> a; ///< x系数
+    std::vector<float> b; ///< y系数
+    std::vector<float> c; ///< z系数
+    std::vector<float> d; ///< 常数项
+
+    PlaneCoefficients() = default;
+
+    /**
+     * @brief 从平面列表构造
+     * @param planes 平面
+     */
+    explicit PlaneCoefficients(const std::vector<Plane>& planes);
+
+    /**
+     * @brief 追加一个平面
+     * @param plane 平面
+     */
+    void push_back(const Plane& plane);
+
+    /**
+     * @brief 平面数量
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+};
+
+/**
+ * @brief 批量计算三平面交点
+ * @param planes SoA 平面系数
+ * @param triples 平面下标，每三个一组（至少 3 * count 个元素，必须小于 planes.size()）
+ * @param count 组数
+ * @param out 输出交点（至少 count 个元素），无唯一交点时为原点
+ * @param valid 输出数组（至少 count 个元素，可为 nullptr），记录每组是否有唯一交点
+ * @param epsilon 行列式绝对值小于它时认为没有唯一交点
+ * @return 有唯一交点的组数
+ * @note 每组只算一次行列式，不再单独做两两平行检查：法向量为单位向量时，任意两个平面平行
+ *       都会使行列式小于平行判断的容差，是否有唯一交点的判断与 intersection(plane1, plane2, plane3) 一致
+ *       （坐标的舍入误差可能略有不同）。
+ *       启用 SSE2 时一次求解4组，组数较多时分块在多个线程上计算。
+ */
+std::size_t intersections(const PlaneCoefficients& planes, const std::uint32_t* triples, std::size_t count,
+                          Point* out, bool* valid = nullptr, float epsilon = 1e-6f);
+
 /**
  * @brief 判断点是否在线段上
  * @param point 点
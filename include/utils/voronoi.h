@@ -0,0 +1,37 @@
+#pragma once
+
+#include "geometry/Polygon.h"
+#include "geometry/Triangulation.h"
+#include <cstdint>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+/**
+ * @brief 从 Delaunay 三角剖分计算所有站点的 Voronoi 单元
+ * @param tin Delaunay 三角剖分（例如 delaunay() 的结果），站点为 tin.points
+ * @param bounds 裁剪边界多边形
+ * @return 与 tin.points 一一对应的单元多边形（逆时针）
+ * @note 每个单元由边界多边形依次被该站点与各 Delaunay 邻点的垂直平分线裁剪得到，
+ *       因此凸包上的无界单元也会被正确截断。边界为凸多边形时结果精确；
+ *       非凸边界下若单元被分成多块，块之间会以零宽度的边相连。
+ *       未出现在三角形中的重复站点得到空多边形。单元在多个线程上并行计算。
+ */
+[[nodiscard]] std::vector<Polygon> voronoi_cells(const Triangulation& tin, const Polygon& bounds);
+
+/**
+ * @brief 只计算指定站点的 Voronoi 单元
+ * @param tin Delaunay 三角剖分
+ * @param sites 站点下标列表
+ * @param bounds 裁剪边界多边形
+ * @return 与 sites 一一对应的单元多边形
+ * @throws std::out_of_range 如果某个站点下标越界
+ * @note 只建立一次“顶点到半边”的索引，然后绕每个请求的站点旋转收集邻点，
+ *       不会生成整个 Voronoi 图
+ */
+[[nodiscard]] std::vector<Polygon> voronoi_cells(const Triangulation& tin, const std::vector<std::uint32_t>& sites,
+                                                 const Polygon& bounds);
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,254 @@
+#include "geometry/BspTree.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+// 等待构建的子树：父节点、属于哪一侧，以及落在这一侧的多边形
+struct Task {
+    std::int32_t parent = BspTree::kNoChild;
+    bool front = true;
+    std::size_t depth = 1;
+    std::vector<std::uint32_t> items;
+};
+
+// 多边形所在的平面：Newell 法向量，经过顶点平均值；面积为零时返回空
+std::optional<Plane> polygon_plane(const Polygon& polygon) {
+    const std::size_t n = polygon.vertices.size();
+    if (n < 3) {
+        return std::nullopt;
+    }
+    double nx = 0.0, ny = 0.0, nz = 0.0;
+    double cx = 0.0, cy = 0.0, cz = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const Point& a = polygon.vertices[i];
+        const Point& b = polygon.vertices[(i + 1) % n];
+        nx += (static_cast<double>(a.y) - b.y) * (static_cast<double>(a.z) + b.z);
+        ny += (static_cast<double>(a.z) - b.z) * (static_cast<double>(a.x) + b.x);
+        nz += (static_cast<double>(a.x) - b.x) * (static_cast<double>(a.y) + b.y);
+        cx += a.x;
+        cy += a.y;
+        cz += a.z;
+    }
+    const double length = std::sqrt(nx * nx + ny * ny + nz * nz);
+    if (!(length > 1e-12)) {
+        return std::nullopt;
+    }
+    return Plane(Point(static_cast<float>(nx / length), static_cast<float>(ny / length), static_cast<float>(nz / length)),
+                 Point(static_cast<float>(cx / n), static_cast<float>(cy / n), static_cast<float>(cz / n)));
+}
+
+// 多边形顶点到平面的有符号距离范围
+inline void distance_range(const Plane& plane, const Polygon& polygon, float& lo, float& hi) noexcept {
+    lo = std::numeric_limits<float>::max();
+    hi = std::numeric_limits<float>::lowest();
+    for (const Point& v : polygon.vertices) {
+        const float d = plane.signed_distance_to(v);
+        lo = std::min(lo, d);
+        hi = std::max(hi, d);
+    }
+}
+
+// 在等间隔的候选中选出代价最小的分割多边形
+std::uint32_t choose_splitter(const std::vector<std::uint32_t>& items, const std::vector<Polygon>& work,
+                              const std::vector<Plane>& planes, const BspBuildOptions& options) {
+    const std::size_t n = items.size();
+    const std::size_t candidates = std::max<std::size_t>(1, std::min(options.candidates, n));
+    const std::size_t samples = std::max<std::size_t>(1, std::min(options.sample_size, n));
+    if (n == 1 || candidates == 1) {
+        return items[0];
+    }
+
+    std::uint32_t best = items[0];
+    float best_cost = std::numeric_limits<float>::max();
+    for (std::size_t k = 0; k < candidates; ++k) {
+        const std::uint32_t candidate = items[k * n / candidates];
+        const Plane& plane = planes[candidate];
+        std::size_t splits = 0, front = 0, back = 0;
+        bool pruned = false;
+        for (std::size_t s = 0; s < samples; ++s) {
+            float lo, hi;
+            distance_range(plane, work[items[s * n / samples]], lo, hi);
+            if (lo >= -options.epsilon) {
+                front += hi > options.epsilon;
+            } else if (hi <= options.epsilon) {
+                ++back;
+            } else {
+                ++splits;
+                // 切分代价只增不减，已经超过当前最优时提前放弃
+                if (options.split_weight * static_cast<float>(splits) >= best_cost) {
+                    pruned = true;
+                    break;
+                }
+            }
+        }
+        if (pruned) {
+            continue;
+        }
+        const float imbalance = static_cast<float>(front > back ? front - back : back - front);
+        const float cost = options.split_weight * static_cast<float>(splits) + options.balance_weight * imbalance;
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+BspTree::BspTree(const std::vector<Polygon>& polygons, const BspBuildOptions& options) {
+    build(polygons, options);
+}
+
+void BspTree::build(const std::vector<Polygon>& polygons, const BspBuildOptions& options) {
+    constexpr std::size_t kMaxIndex = std::numeric_limits<std::uint32_t>::max();
+    if (polygons.size() >= kMaxIndex) {
+        throw std::length_error("Too many polygons for BspTree");
+    }
+    nodes_.clear();
+    fragments_.clear();
+    sources_.clear();
+    split_count_ = 0;
+    depth_ = 0;
+
+    // 工作集：多边形（切分后就地替换为正侧片段）、所在平面与来源下标
+    std::vector<Polygon> work;
+    std::vector<Plane> planes;
+    std::vector<std::uint32_t> origin;
+    work.reserve(polygons.size());
+    planes.reserve(polygons.size());
+    origin.reserve(polygons.size());
+    for (std::size_t i = 0; i < polygons.size(); ++i) {
+        if (auto plane = polygon_plane(polygons[i])) {
+            work.push_back(polygons[i]);
+            planes.push_back(*plane);
+            origin.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+    if (work.empty()) {
+        return;
+    }
+
+    std::vector<Task> stack;
+    stack.emplace_back();
+    stack.back().items.resize(work.size());
+    for (std::size_t i = 0; i < work.size(); ++i) {
+        stack.back().items[i] = static_cast<std::uint32_t>(i);
+    }
+
+    while (!stack.empty()) {
+        Task task = std::move(stack.back());
+        stack.pop_back();
+
+        const std::uint32_t splitter = choose_splitter(task.items, work, planes, options);
+        const Plane plane = planes[splitter];
+        const auto index = static_cast<std::int32_t>(nodes_.size());
+        nodes_.push_back(Node{plane, kNoChild, kNoChild, static_cast<std::uint32_t>(fragments_.size()), 0});
+        if (task.parent != kNoChild) {
+            (task.front ? nodes_[task.parent].front : nodes_[task.parent].back) = index;
+        }
+        depth_ = std::max(depth_, task.depth);
+
+        std::vector<std::uint32_t> front_items, back_items;
+        for (std::uint32_t item : task.items) {
+            float lo = 0.0f, hi = 0.0f;
+            if (item != splitter) {
+                distance_range(plane, work[item], lo, hi);
+            }
+            if (item == splitter || (lo >= -options.epsilon && hi <= options.epsilon)) {
+                fragments_.add_polygon(work[item]);
+                sources_.push_back(origin[item]);
+            } else if (lo >= -options.epsilon) {
+                front_items.push_back(item);
+            } else if (hi <= options.epsilon) {
+                back_items.push_back(item);
+            } else {
+                if (work.size() >= kMaxIndex) {
+                    throw std::length_error("Too many fragments for BspTree");
+                }
+                PolygonSplit pieces = plane.split(work[item], options.epsilon);
+                work[item] = std::move(pieces.front);
+                front_items.push_back(item);
+                back_items.push_back(static_cast<std::uint32_t>(work.size()));
+                work.push_back(std::move(pieces.back));
+                planes.push_back(planes[item]);
+                origin.push_back(origin[item]);
+                ++split_count_;
+            }
+        }
+        nodes_[index].count = static_cast<std::uint32_t>(fragments_.size()) - nodes_[index].first;
+
+        // 先压负侧再压正侧，正侧子树紧跟在当前节点之后
+        if (!back_items.empty()) {
+            stack.push_back(Task{index, false, task.depth + 1, std::move(back_items)});
+        }
+        if (!front_items.empty()) {
+            stack.push_back(Task{index, true, task.depth + 1, std::move(front_items)});
+        }
+    }
+}
+
+bool BspTree::empty() const noexcept {
+    return nodes_.empty();
+}
+
+const std::vector<BspTree::Node>& BspTree::nodes() const noexcept {
+    return nodes_;
+}
+
+const PolygonBuffer& BspTree::fragments() const noexcept {
+    return fragments_;
+}
+
+const std::vector<std::uint32_t>& BspTree::sources() const noexcept {
+    return sources_;
+}
+
+std::size_t BspTree::split_count() const noexcept {
+    return split_count_;
+}
+
+std::size_t BspTree::depth() const noexcept {
+    return depth_;
+}
+
+void BspTree::front_to_back(const Point& eye, std::vector<std::uint32_t>& out) const {
+    out.clear();
+    if (nodes_.empty()) {
+        return;
+    }
+    // 非负值表示待展开的节点，负值 ~i 表示输出节点 i 的共面片段
+    std::vector<std::int32_t> stack{0};
+    while (!stack.empty()) {
+        const std::int32_t entry = stack.back();
+        stack.pop_back();
+        if (entry < 0) {
+            const Node& node = nodes_[~entry];
+            for (std::uint32_t f = node.first; f < node.first + node.count; ++f) {
+                out.push_back(f);
+            }
+            continue;
+        }
+        const Node& node = nodes_[entry];
+        const bool eye_in_front = node.plane.signed_distance_to(eye) >= 0.0f;
+        const std::int32_t near_child = eye_in_front ? node.front : node.back;
+        const std::int32_t far_child = eye_in_front ? node.back : node.front;
+        if (far_child != kNoChild) {
+            stack.push_back(far_child);
+        }
+        stack.push_back(~entry);
+        if (near_child != kNoChild) {
+            stack.push_back(near_child);
+        }
+    }
+}
+
+void BspTree::back_to_front(const Point& eye, std::vector<std::uint32_t>& out) const {
+    front_to_back(eye, out);
+    std::reverse(out.begin(), out.end());
+}
@@ -0,0 +1,51 @@
+#include "geometry/ConvexPolyhedron.h"
+#include <stdexcept>
+
+std::size_t ConvexPolyhedron::face_count() const noexcept {
+    return face_offsets.empty() ? 0 : face_offsets.size() - 1;
+}
+
+std::size_t ConvexPolyhedron::face_vertex_count(std::size_t index) const noexcept {
+    return face_offsets[index + 1] - face_offsets[index];
+}
+
+Polygon ConvexPolyhedron::face(std::size_t index) const {
+    if (index >= face_count()) {
+        throw std::out_of_range("Face index out of range");
+    }
+    Polygon polygon;
+    polygon.vertices.reserve(face_vertex_count(index));
+    for (std::size_t k = face_offsets[index]; k < face_offsets[index + 1]; ++k) {
+        polygon.vertices.push_back(vertices[face_indices[k]]);
+    }
+    return polygon;
+}
+
+std::vector<std::uint32_t> ConvexPolyhedron::triangles() const {
+    std::vector<std::uint32_t> result;
+    for (std::size_t f = 0; f < face_count(); ++f) {
+        const std::size_t first = face_offsets[f];
+        for (std::size_t k = first + 1; k + 1 < face_offsets[f + 1]; ++k) {
+            result.push_back(face_indices[first]);
+            result.push_back(face_indices[k]);
+            result.push_back(face_indices[k + 1]);
+        }
+    }
+    return result;
+}
+
+float ConvexPolyhedron::volume() const noexcept {
+    // 散度定理：每个扇形三角形与原点组成的四面体的有符号体积之和
+    double total = 0.0;
+    for (std::size_t f = 0; f < face_count(); ++f) {
+        const Point& a = vertices[face_indices[face_offsets[f]]];
+        for (std::size_t k = face_offsets[f] + 1; k + 1 < face_offsets[f + 1]; ++k) {
+            const Point& b = vertices[face_indices[k]];
+            const Point& c = vertices[face_indices[k + 1]];
+            total += a.x * (static_cast<double>(b.y) * c.z - static_cast<double>(b.z) * c.y)
+                     + a.y * (static_cast<double>(b.z) * c.x - static_cast<double>(b.x) * c.z)
+                     + a.z * (static_cast<double>(b.x) * c.y - static_cast<double>(b.y) * c.x);
+        }
+    }
+    return static_cast<float>(total / 6.0);
+}
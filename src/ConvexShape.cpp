@@ -0,0 +1,89 @@
+#include "geometry/ConvexShape.h"
+#include <stdexcept>
+
+namespace {
+
+// 线性扫描所有顶点，点积相同时取下标最小者
+std::size_t scan_support(const std::vector<Point>& vertices, const Point& direction) noexcept {
+    std::size_t best = 0;
+    double best_dot = dot_product(vertices[0], direction);
+    for (std::size_t i = 1; i < vertices.size(); ++i) {
+        const double d = dot_product(vertices[i], direction);
+        if (d > best_dot) {
+            best_dot = d;
+            best = i;
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+ConvexShape::ConvexShape(const std::vector<Point>& vertices) : vertices(vertices) {
+    if (vertices.empty()) {
+        throw std::invalid_argument("Convex shape requires at least one vertex");
+    }
+}
+
+ConvexShape::ConvexShape(const Polygon& polygon) : vertices(polygon.vertices) {
+    if (vertices.empty()) {
+        throw std::invalid_argument("Convex shape requires at least one vertex");
+    }
+    // 只有真正的凸多边形才能沿环爬山，否则退化为线性扫描
+    ordered_loop_ = polygon.is_convex();
+}
+
+std::size_t ConvexShape::support(const Point& direction, std::size_t hint) const noexcept {
+    const std::size_t n = vertices.size();
+    if (n == 0) {
+        return 0;
+    }
+
+    if (!ordered_loop_ || n < 4) {
+        // 无序点集：线性扫描
+        return scan_support(vertices, direction);
+    }
+
+    // 凸多边形上的点积序列是双调的，从提示位置爬山即可找到最大值。
+    // is_convex() 接受共线点与重复点，它们会在序列中形成平台，爬山可能停在平台上的错误顶点，
+    // 因此遇到相邻点积相等时改用线性扫描
+    std::size_t best = hint % n;
+    double best_dot = dot_product(vertices[best], direction);
+    const double next_dot = dot_product(vertices[(best + 1) % n], direction);
+    const double prev_dot = dot_product(vertices[(best + n - 1) % n], direction);
+
+    std::size_t step;
+    if (next_dot == best_dot || prev_dot == best_dot) {
+        return scan_support(vertices, direction);
+    } else if (next_dot > best_dot) {
+        step = 1;
+    } else if (prev_dot > best_dot) {
+        step = n - 1;
+    } else {
+        return best;
+    }
+
+    for (std::size_t count = 0; count < n; ++count) {
+        const std::size_t candidate = (best + step) % n;
+        const double d = dot_product(vertices[candidate], direction);
+        if (d == best_dot) {
+            return scan_support(vertices, direction);
+        }
+        if (d < best_dot) {
+            break;
+        }
+        best = candidate;
+        best_dot = d;
+    }
+
+    return best;
+}
+
+Point ConvexShape::vertex(std::size_t index) const noexcept {
+    return vertices[index] + position;
+}
+
+std::ostream& operator<<(std::ostream& os, const ConvexShape& shape) {
+    os << "ConvexShape[position=" << shape.position << ", vertices=" << shape.vertices.size() << "]";
+    return os;
+}
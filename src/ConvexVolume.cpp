@@ -0,0 +1,239 @@
+#include "geometry/ConvexVolume.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr std::size_t kGroupSize = 4;
+
+// 一组（4个）平面的判定结果，每个平面占一位
+struct GroupMasks {
+    unsigned reject;   ///< 物体完全在该平面负侧
+    unsigned straddle; ///< 物体跨越该平面
+};
+
+// 物体中心到平面的距离 dist 与物体在法向量上的投影半径 rho 比较：
+// dist < -rho 时整个物体在负侧（p-vertex 在外），dist < rho 时 n-vertex 在外，物体跨越平面
+inline GroupMasks test_group(const float* nx, const float* ny, const float* nz, const float* d,
+                             const float* ax, const float* ay, const float* az,
+                             float cx, float cy, float cz, float ex, float ey, float ez, float r) noexcept {
+#if defined(__SSE2__)
+    const __m128 dist = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(nx), _mm_set1_ps(cx)),
+                                                         _mm_mul_ps(_mm_loadu_ps(ny), _mm_set1_ps(cy))),
+                                              _mm_mul_ps(_mm_loadu_ps(nz), _mm_set1_ps(cz))),
+                                   _mm_loadu_ps(d));
+    const __m128 rho = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(ax), _mm_set1_ps(ex)),
+                                                        _mm_mul_ps(_mm_loadu_ps(ay), _mm_set1_ps(ey))),
+                                             _mm_mul_ps(_mm_loadu_ps(az), _mm_set1_ps(ez))),
+                                  _mm_set1_ps(r));
+    const __m128 neg_rho = _mm_sub_ps(_mm_setzero_ps(), rho);
+    return {static_cast<unsigned>(_mm_movemask_ps(_mm_cmplt_ps(dist, neg_rho))),
+            static_cast<unsigned>(_mm_movemask_ps(_mm_cmplt_ps(dist, rho)))};
+#else
+    GroupMasks masks{0, 0};
+    for (std::size_t i = 0; i < kGroupSize; ++i) {
+        const float dist = nx[i] * cx + ny[i] * cy + nz[i] * cz + d[i];
+        const float rho = ax[i] * ex + ay[i] * ey + az[i] * ez + r;
+        masks.reject |= static_cast<unsigned>(dist < -rho) << i;
+        masks.straddle |= static_cast<unsigned>(dist < rho) << i;
+    }
+    return masks;
+#endif
+}
+
+} // namespace
+
+ConvexVolume::ConvexVolume(const std::vector<Plane>& planes) {
+    for (const Plane& plane : planes) {
+        add_plane(plane);
+    }
+}
+
+ConvexVolume ConvexVolume::frustum(const Point& eye, const Point& forward, const Point& up,
+                                   float fov_y, float aspect, float near_distance, float far_distance) {
+    if (!(fov_y > 0.0f && fov_y < 3.14159265f) || !(aspect > 0.0f) ||
+        !(near_distance > 0.0f && near_distance < far_distance)) {
+        throw std::invalid_argument("Invalid frustum parameters");
+    }
+    const double forward_length = forward.magnitude();
+    if (forward_length < 1e-6) {
+        throw std::invalid_argument("Forward vector cannot be zero");
+    }
+    const Point f = forward / forward_length;
+    const Point side = cross_product(f, up);
+    const double side_length = side.magnitude();
+    if (side_length < 1e-6) {
+        throw std::invalid_argument("Forward and up vectors cannot be parallel");
+    }
+    const Point right = side / side_length;
+    const Point true_up = cross_product(right, f);
+
+    const float half_v = std::tan(fov_y * 0.5f);
+    const float half_h = half_v * aspect;
+
+    // 侧面都经过相机位置；法向量由侧棱方向与另一轴叉乘化简而来，均指向视锥内部
+    ConvexVolume volume;
+    volume.add_plane(Plane(f, eye + f * near_distance));
+    volume.add_plane(Plane(f * -1.0, eye + f * far_distance));
+    volume.add_plane(Plane(right + f * half_h, eye));          // 左
+    volume.add_plane(Plane(right * -1.0 + f * half_h, eye));   // 右
+    volume.add_plane(Plane(true_up * -1.0 + f * half_v, eye)); // 上
+    volume.add_plane(Plane(true_up + f * half_v, eye));        // 下
+    return volume;
+}
+
+void ConvexVolume::add_plane(const Plane& plane) {
+    const std::size_t index = planes_.size();
+    planes_.push_back(plane);
+    if (index == nx_.size()) {
+        // 新开一组，先全部填成补齐平面
+        nx_.resize(index + kGroupSize, 0.0f);
+        ny_.resize(index + kGroupSize, 0.0f);
+        nz_.resize(index + kGroupSize, 0.0f);
+        d_.resize(index + kGroupSize, FLT_MAX);
+        ax_.resize(index + kGroupSize, 0.0f);
+        ay_.resize(index + kGroupSize, 0.0f);
+        az_.resize(index + kGroupSize, 0.0f);
+    }
+    nx_[index] = plane.normal.x;
+    ny_[index] = plane.normal.y;
+    nz_[index] = plane.normal.z;
+    d_[index] = plane.d();
+    ax_[index] = std::abs(plane.normal.x);
+    ay_[index] = std::abs(plane.normal.y);
+    az_[index] = std::abs(plane.normal.z);
+}
+
+std::size_t ConvexVolume::plane_count() const noexcept {
+    return planes_.size();
+}
+
+const Plane& ConvexVolume::plane(std::size_t index) const {
+    return planes_.at(index);
+}
+
+Containment ConvexVolume::classify_bounds(float cx, float cy, float cz, float ex, float ey, float ez, float r,
+                                          std::uint32_t* hint) const noexcept {
+    const std::size_t groups = nx_.size() / kGroupSize;
+    const auto run = [&](std::size_t g) {
+        const std::size_t o = g * kGroupSize;
+        return test_group(&nx_[o], &ny_[o], &nz_[o], &d_[o], &ax_[o], &ay_[o], &az_[o], cx, cy, cz, ex, ey, ez, r);
+    };
+
+    unsigned straddle = 0;
+    std::size_t skip = groups;
+    if (hint != nullptr && *hint < groups) {
+        // 上一次剔除该物体的平面组最可能再次剔除它
+        skip = *hint;
+        const GroupMasks masks = run(skip);
+        if (masks.reject != 0) {
+            return Containment::Outside;
+        }
+        straddle |= masks.straddle;
+    }
+    for (std::size_t g = 0; g < groups; ++g) {
+        if (g == skip) {
+            continue;
+        }
+        const GroupMasks masks = run(g);
+        if (masks.reject != 0) {
+            if (hint != nullptr) {
+                *hint = static_cast<std::uint32_t>(g);
+            }
+            return Containment::Outside;
+        }
+        straddle |= masks.straddle;
+    }
+    return straddle != 0 ? Containment::Intersecting : Containment::Inside;
+}
+
+Containment ConvexVolume::classify(const Point& point) const noexcept {
+    return classify_bounds(point.x, point.y, point.z, 0.0f, 0.0f, 0.0f, 0.0f, nullptr);
+}
+
+Containment ConvexVolume::classify(const BoundingBox& box) const noexcept {
+    std::uint32_t hint = kNoHint;
+    return classify(box, hint);
+}
+
+Containment ConvexVolume::classify(const Sphere& sphere) const noexcept {
+    std::uint32_t hint = kNoHint;
+    return classify(sphere, hint);
+}
+
+Containment ConvexVolume::classify(const BoundingBox& box, std::uint32_t& hint) const noexcept {
+    const Point c = box.center();
+    const Point e = box.half_extent();
+    return classify_bounds(c.x, c.y, c.z, e.x, e.y, e.z, 0.0f, &hint);
+}
+
+Containment ConvexVolume::classify(const Sphere& sphere, std::uint32_t& hint) const noexcept {
+    const Point& c = sphere.center;
+    return classify_bounds(c.x, c.y, c.z, 0.0f, 0.0f, 0.0f, sphere.radius, &hint);
+}
+
+Containment ConvexVolume::classify(const Line& segment) const noexcept {
+    // Cyrus-Beck：逐平面收缩线段的参数区间 [t0, t1]
+    const Point& a = segment.start;
+    const Point& b = segment.end;
+    float t0 = 0.0f;
+    float t1 = 1.0f;
+    bool clipped = false;
+    for (std::size_t i = 0; i < planes_.size(); ++i) {
+        const float da = nx_[i] * a.x + ny_[i] * a.y + nz_[i] * a.z + d_[i];
+        const float db = nx_[i] * b.x + ny_[i] * b.y + nz_[i] * b.z + d_[i];
+        if (da < 0.0f && db < 0.0f) {
+            return Containment::Outside;
+        }
+        if (da >= 0.0f && db >= 0.0f) {
+            continue;
+        }
+        clipped = true;
+        const float t = da / (da - db);
+        if (da < 0.0f) {
+            t0 = std::max(t0, t);
+        } else {
+            t1 = std::min(t1, t);
+        }
+        if (t0 > t1) {
+            return Containment::Outside;
+        }
+    }
+    return clipped ? Containment::Intersecting : Containment::Inside;
+}
+
+void ConvexVolume::classify(const Point* points, std::size_t count, Containment* out) const noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = classify(points[i]);
+    }
+}
+
+void ConvexVolume::classify(const BoundingBox* boxes, std::size_t count, Containment* out,
+                            std::uint32_t* hints) const noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        const Point c = boxes[i].center();
+        const Point e = boxes[i].half_extent();
+        out[i] = classify_bounds(c.x, c.y, c.z, e.x, e.y, e.z, 0.0f, hints != nullptr ? &hints[i] : nullptr);
+    }
+}
+
+void ConvexVolume::classify(const Sphere* spheres, std::size_t count, Containment* out,
+                            std::uint32_t* hints) const noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        const Point& c = spheres[i].center;
+        out[i] = classify_bounds(c.x, c.y, c.z, 0.0f, 0.0f, 0.0f, spheres[i].radius,
+                                 hints != nullptr ? &hints[i] : nullptr);
+    }
+}
+
+void ConvexVolume::classify(const Line* segments, std::size_t count, Containment* out) const noexcept {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = classify(segments[i]);
+    }
+}
@@ -1,2 +1,66 @@
 #include "geometry/Line.h"
+#include "utils/predicates.h"
 #include <cmath>
+
+namespace {
+
+// 精确模式下方向只取符号，共线判断没有容差；两种模式分别实例化，避免在热循环里反复判断策略
+template <bool Exact>
+bool segments_intersect(const Point &p1, const Point &p2, const Point &p3, const Point &p4) noexcept
+{
+    constexpr float epsilon = Exact ? 0.0f : std::numeric_limits<float>::epsilon() * 1e6f;
+
+    // Calculate orientation values
+    const auto ccw = [](const Point &a, const Point &b, const Point &c)
+    {
+        if constexpr (Exact)
+        {
+            const double val = geometry::utils::orient2d(a, b, c);
+            return static_cast<int>(val > 0.0) - static_cast<int>(val < 0.0);
+        }
+        else
+        {
+            const float val = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+            return (val > epsilon) ? 1 : (val < -epsilon) ? -1
+                                                           : 0;
+        }
+    };
+
+    const int o1 = ccw(p1, p2, p3);
+    const int o2 = ccw(p1, p2, p4);
+    const int o3 = ccw(p3, p4, p1);
+    const int o4 = ccw(p3, p4, p2);
+
+    // General case
+    if (o1 != o2 && o3 != o4)
+        return true;
+
+    // Special cases (collinear points)
+    const auto on_segment = [](const Point &a, const Point &b, const Point &c)
+    {
+        return (a.x <= std::max(b.x, c.x) + epsilon &&
+                a.x >= std::min(b.x, c.x) - epsilon &&
+                a.y <= std::max(b.y, c.y) + epsilon &&
+                a.y >= std::min(b.y, c.y) - epsilon);
+    };
+
+    if (o1 == 0 && on_segment(p3, p1, p2))
+        return true;
+    if (o2 == 0 && on_segment(p4, p1, p2))
+        return true;
+    if (o3 == 0 && on_segment(p1, p3, p4))
+        return true;
+    if (o4 == 0 && on_segment(p2, p3, p4))
+        return true;
+
+    return false;
+}
+
+} // namespace
+
+bool Line::intersects(const Line &other) const noexcept
+{
+    if (geometry::utils::predicate_policy() == geometry::utils::PredicatePolicy::Exact)
+        return segments_intersect<true>(start, end, other.start, other.end);
+    return segments_intersect<false>(start, end, other.start, other.end);
+}
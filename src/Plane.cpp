@@ -2,6 +2,165 @@
 #include <stdexcept>
 #include <cmath>
 #include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+static_assert(sizeof(Point) == 3 * sizeof(float), "batch kernels read Point arrays as packed floats");
+
+// 与 signed_distance_to 相同的运算顺序，保证批量结果与逐点结果一致
+inline float plane_distance(const Point& n, float d, const Point& p) noexcept {
+    return static_cast<float>(dot_product(n, p)) + d;
+}
+
+inline std::int8_t side_of(float distance, float epsilon) noexcept {
+    return static_cast<std::int8_t>((distance > epsilon) - (distance < -epsilon));
+}
+
+// 按已经算好的顶点距离切分一个多边形，两侧的顶点分别追加到 front 和 back；返回是否共面
+bool split_vertices(const Point* v, std::size_t n, const float* dist, const Point& normal, float epsilon,
+                    std::vector<Point>& front, std::vector<Point>& back) {
+    if (n == 0) {
+        return false;
+    }
+    bool has_front = false, has_back = false;
+    for (std::size_t i = 0; i < n; ++i) {
+        has_front |= dist[i] > epsilon;
+        has_back |= dist[i] < -epsilon;
+    }
+    if (!has_front && !has_back) {
+        // Newell 法向量给出顶点的环绕方向，与平面法向量同向时归入正侧
+        double nx = 0.0, ny = 0.0, nz = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const Point& a = v[i];
+            const Point& b = v[(i + 1) % n];
+            nx += (static_cast<double>(a.y) - b.y) * (static_cast<double>(a.z) + b.z);
+            ny += (static_cast<double>(a.z) - b.z) * (static_cast<double>(a.x) + b.x);
+            nz += (static_cast<double>(a.x) - b.x) * (static_cast<double>(a.y) + b.y);
+        }
+        std::vector<Point>& side = (nx * normal.x + ny * normal.y + nz * normal.z >= 0.0) ? front : back;
+        side.insert(side.end(), v, v + n);
+        return true;
+    }
+    if (!has_back) {
+        front.insert(front.end(), v, v + n);
+        return false;
+    }
+    if (!has_front) {
+        back.insert(back.end(), v, v + n);
+        return false;
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t j = (i + 1) % n;
+        const std::int8_t si = side_of(dist[i], epsilon);
+        const std::int8_t sj = side_of(dist[j], epsilon);
+        if (si >= 0) {
+            front.push_back(v[i]);
+        }
+        if (si <= 0) {
+            back.push_back(v[i]);
+        }
+        if (si * sj < 0) {
+            // 与 intersection_with 的参数相同，但直接复用已算好的距离；从正侧端点插值保证公共边的交点一致
+            const std::size_t f = si > 0 ? i : j;
+            const std::size_t b = si > 0 ? j : i;
+            const float t = dist[f] / (dist[f] - dist[b]);
+            const Point p = v[f] + (v[b] - v[f]) * t;
+            front.push_back(p);
+            back.push_back(p);
+        }
+    }
+    return false;
+}
+
+// 3x3 对称矩阵最小特征值对应的单位特征向量（闭式特征值 + 行向量叉积）；
+// 最小特征值不唯一或矩阵为零时返回 false
+bool smallest_eigenvector(const double (&a)[3][3], double (&v)[3]) noexcept {
+    v[0] = v[1] = v[2] = 0.0;
+    const double p1 = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+    const double q = (a[0][0] + a[1][1] + a[2][2]) / 3.0;
+    const double p2 = (a[0][0] - q) * (a[0][0] - q) + (a[1][1] - q) * (a[1][1] - q) + (a[2][2] - q) * (a[2][2] - q)
+                      + 2.0 * p1;
+    const double p = std::sqrt(p2 / 6.0);
+    if (!(p > 0.0)) {
+        return false;
+    }
+    double b[3][3];
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            b[r][c] = (a[r][c] - (r == c ? q : 0.0)) / p;
+        }
+    }
+    const double det = b[0][0] * (b[1][1] * b[2][2] - b[1][2] * b[2][1])
+                       - b[0][1] * (b[1][0] * b[2][2] - b[1][2] * b[2][0])
+                       + b[0][2] * (b[1][0] * b[2][1] - b[1][1] * b[2][0]);
+    const double phi = std::acos(std::clamp(det / 2.0, -1.0, 1.0)) / 3.0;
+    constexpr double kTwoThirdsPi = 2.0943951023931954923;
+    const double largest = q + 2.0 * p * std::cos(phi);
+    const double smallest = q + 2.0 * p * std::cos(phi + kTwoThirdsPi);
+    const double middle = 3.0 * q - largest - smallest;
+    // 中间特征值也接近零说明点集共线，平面不唯一
+    if (!(middle - smallest > 1e-10 * (largest - smallest))) {
+        return false;
+    }
+
+    // A - λI 的秩为2，任意两行的叉积都与特征向量平行，取最长的一个以减小误差
+    const double m[3][3] = {{a[0][0] - smallest, a[0][1], a[0][2]},
+                            {a[1][0], a[1][1] - smallest, a[1][2]},
+                            {a[2][0], a[2][1], a[2][2] - smallest}};
+    double best = 0.0;
+    for (int i = 0; i < 3; ++i) {
+        const double* r0 = m[i];
+        const double* r1 = m[(i + 1) % 3];
+        const double c[3] = {r0[1] * r1[2] - r0[2] * r1[1], r0[2] * r1[0] - r0[0] * r1[2], r0[0] * r1[1] - r0[1] * r1[0]};
+        const double length = c[0] * c[0] + c[1] * c[1] + c[2] * c[2];
+        if (length > best) {
+            best = length;
+            v[0] = c[0];
+            v[1] = c[1];
+            v[2] = c[2];
+        }
+    }
+    if (!(best > 0.0)) {
+        return false;
+    }
+    const double length = std::sqrt(best);
+    v[0] /= length;
+    v[1] /= length;
+    v[2] /= length;
+    return true;
+}
+
+#if defined(__SSE2__)
+// 读取4个连续的点（12个float）并计算它们的有符号距离
+inline __m128 plane_distance4(const Point* p, __m128 nx, __m128 ny, __m128 nz, __m128 d) noexcept {
+    const float* f = reinterpret_cast<const float*>(p);
+    const __m128 a = _mm_loadu_ps(f);     // x0 y0 z0 x1
+    const __m128 b = _mm_loadu_ps(f + 4); // y1 z1 x2 y2
+    const __m128 c = _mm_loadu_ps(f + 8); // z2 x3 y3 z3
+
+    // 拆成 SoA：xs = x0..x3, ys = y0..y3, zs = z0..z3
+    const __m128 t = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+    const __m128 xs = _mm_shuffle_ps(a, t, _MM_SHUFFLE(2, 0, 3, 0));
+    const __m128 u = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+    const __m128 ys = _mm_shuffle_ps(u, t, _MM_SHUFFLE(3, 1, 2, 0));
+    const __m128 v = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+    const __m128 w = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));
+    const __m128 zs = _mm_shuffle_ps(v, w, _MM_SHUFFLE(2, 0, 2, 0));
+
+    const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, nx), _mm_mul_ps(ys, ny)), _mm_mul_ps(zs, nz));
+    return _mm_add_ps(dot, d);
+}
+#endif
+
+} // namespace
 
 Plane::Plane(const Point& normal, const Point& point) 
     : point(point) {
@@ -52,18 +211,145 @@ Plane::Plane(float a, float b, float c, float d) {
     }
 }
 
+std::optional<Plane> Plane::fit(const Point* points, std::size_t count) {
+    if (count < 3) {
+        return std::nullopt;
+    }
+    double cx = 0.0, cy = 0.0, cz = 0.0;
+    for (std::size_t i = 0; i < count; ++i) {
+        cx += points[i].x;
+        cy += points[i].y;
+        cz += points[i].z;
+    }
+    cx /= static_cast<double>(count);
+    cy /= static_cast<double>(count);
+    cz /= static_cast<double>(count);
+
+    // 先减去质心再累加，避免坐标很大时协方差被抵消
+    double covariance[3][3] = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+    for (std::size_t i = 0; i < count; ++i) {
+        const double dx = points[i].x - cx, dy = points[i].y - cy, dz = points[i].z - cz;
+        covariance[0][0] += dx * dx;
+        covariance[0][1] += dx * dy;
+        covariance[0][2] += dx * dz;
+        covariance[1][1] += dy * dy;
+        covariance[1][2] += dy * dz;
+        covariance[2][2] += dz * dz;
+    }
+    covariance[1][0] = covariance[0][1];
+    covariance[2][0] = covariance[0][2];
+    covariance[2][1] = covariance[1][2];
+
+    double n[3] = {0.0, 0.0, 0.0};
+    if (!smallest_eigenvector(covariance, n)) {
+        return std::nullopt;
+    }
+    return Plane(Point(static_cast<float>(n[0]), static_cast<float>(n[1]), static_cast<float>(n[2])),
+                 Point(static_cast<float>(cx), static_cast<float>(cy), static_cast<float>(cz)));
+}
+
 float Plane::d() const noexcept {
     return -static_cast<float>(dot_product(normal, point));
 }
 
 float Plane::signed_distance_to(const Point& p) const noexcept {
-    return static_cast<float>(dot_product(normal, p)) + d();
+    return plane_distance(normal, d(), p);
 }
 
 float Plane::distance_to(const Point& p) const noexcept {
     return std::abs(signed_distance_to(p));
 }
 
+void Plane::signed_distances(const Point* points, std::size_t count, float* out) const noexcept {
+    const float offset = d();
+    std::size_t i = 0;
+#if defined(__SSE2__)
+    const __m128 nx = _mm_set1_ps(normal.x), ny = _mm_set1_ps(normal.y), nz = _mm_set1_ps(normal.z);
+    const __m128 d = _mm_set1_ps(offset);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, plane_distance4(points + i, nx, ny, nz, d));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = plane_distance(normal, offset, points[i]);
+    }
+}
+
+void Plane::classify(const Point* points, std::size_t count, std::int8_t* out, float epsilon) const noexcept {
+    const float offset = d();
+    std::size_t i = 0;
+#if defined(__SSE2__)
+    const __m128 nx = _mm_set1_ps(normal.x), ny = _mm_set1_ps(normal.y), nz = _mm_set1_ps(normal.z);
+    const __m128 d = _mm_set1_ps(offset);
+    const __m128 upper = _mm_set1_ps(epsilon), lower = _mm_set1_ps(-epsilon);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 dist = plane_distance4(points + i, nx, ny, nz, d);
+        // 比较为真时掩码是全1（即整数-1），所以 back - front 正好是 1、-1 或 0
+        const __m128i front = _mm_castps_si128(_mm_cmpgt_ps(dist, upper));
+        const __m128i back = _mm_castps_si128(_mm_cmplt_ps(dist, lower));
+        const __m128i side = _mm_sub_epi32(back, front);
+        const __m128i packed = _mm_packs_epi16(_mm_packs_epi32(side, side), _mm_setzero_si128());
+        const int bytes = _mm_cvtsi128_si32(packed);
+        std::memcpy(out + i, &bytes, 4);
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = side_of(plane_distance(normal, offset, points[i]), epsilon);
+    }
+}
+
+PlanePartition Plane::partition(Point* points, std::size_t count, float epsilon) const noexcept {
+    // 三路划分：[0, front) 正侧，[front, mid) 平面上，[mid, back) 未处理，[back, count) 负侧
+    const float offset = d();
+    std::size_t front = 0, mid = 0, back = count;
+    while (mid < back) {
+        const std::int8_t side = side_of(plane_distance(normal, offset, points[mid]), epsilon);
+        if (side > 0) {
+            std::swap(points[front++], points[mid++]);
+        } else if (side < 0) {
+            std::swap(points[mid], points[--back]);
+        } else {
+            ++mid;
+        }
+    }
+
+    PlanePartition result;
+    result.front = front;
+    result.on = back - front;
+    result.back = count - back;
+    return result;
+}
+
+PolygonSplit Plane::split(const Polygon& polygon, float epsilon) const {
+    const std::size_t n = polygon.vertices.size();
+    std::vector<float> dist(n);
+    signed_distances(polygon.vertices.data(), n, dist.data());
+
+    PolygonSplit result;
+    result.coplanar = split_vertices(polygon.vertices.data(), n, dist.data(), normal, epsilon,
+                                     result.front.vertices, result.back.vertices);
+    return result;
+}
+
+void Plane::split(const Polygon* polygons, std::size_t count, PolygonBuffer& front, PolygonBuffer& back,
+                  bool* coplanar, float epsilon) const {
+    front.clear();
+    back.clear();
+    std::vector<float> dist;
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::vector<Point>& vertices = polygons[i].vertices;
+        dist.resize(vertices.size());
+        signed_distances(vertices.data(), vertices.size(), dist.data());
+        const bool flat = split_vertices(vertices.data(), vertices.size(), dist.data(), normal, epsilon,
+                                         front.vertices, back.vertices);
+        front.close_polygon();
+        back.close_polygon();
+        if (coplanar != nullptr) {
+            coplanar[i] = flat;
+        }
+    }
+}
+
 bool Plane::intersects(const Line& line) const noexcept {
     // 计算直线方向与平面法向量的点积
     Point direction = line.end - line.start;
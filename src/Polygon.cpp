@@ -1,9 +1,22 @@
 #include "geometry/Polygon.h"
+#include "utils/predicates.h"
 #include <algorithm>
 #include <cmath>
 #include <stdexcept>
 #include <stack>
 
+namespace {
+
+// p1 -> p2 -> p3 的转向（叉积的z分量），exact 为 true 时符号精确
+double turn(const Point& p1, const Point& p2, const Point& p3, bool exact) noexcept {
+    if (exact) {
+        return geometry::utils::orient2d(p1, p2, p3);
+    }
+    return (p2.x - p1.x) * (p3.y - p2.y) - (p2.y - p1.y) * (p3.x - p2.x);
+}
+
+} // namespace
+
 Polygon::Polygon(const std::vector<Point>& vertices) : vertices(vertices) {}
 
 void Polygon::add_vertex(const Point& point) {
@@ -11,6 +24,11 @@ void Polygon::add_vertex(const Point& point) {
 }
 
 float Polygon::area() const noexcept {
+    // 取有符号面积的绝对值
+    return std::abs(signed_area());
+}
+
+float Polygon::signed_area() const noexcept {
     if (vertices.size() < 3) {
         return 0.0f;
     }
@@ -24,8 +42,7 @@ float Polygon::area() const noexcept {
         sum += (current.x * next.y - next.x * current.y);
     }
     
-    // 取绝对值并除以2
-    return std::abs(sum) * 0.5f;
+    return sum * 0.5f;
 }
 
 bool Polygon::contains_point(const Point& point, bool include_boundary) const noexcept {
@@ -129,6 +146,7 @@ bool Polygon::is_convex() const noexcept {
     
     bool sign = false;
     bool sign_set = false;
+    const bool exact = geometry::utils::predicate_policy() == geometry::utils::PredicatePolicy::Exact;
     
     for (size_t i = 0; i < vertices.size(); ++i) {
         const Point& p1 = vertices[i];
@@ -136,7 +154,7 @@ bool Polygon::is_convex() const noexcept {
         const Point& p3 = vertices[(i + 2) % vertices.size()];
         
         // 计算叉积的z分量
-        float cross_z = (p2.x - p1.x) * (p3.y - p2.y) - (p2.y - p1.y) * (p3.x - p2.x);
+        const double cross_z = turn(p1, p2, p3, exact);
         
         // 第一次设置符号
         if (!sign_set) {
@@ -172,18 +190,30 @@ Polygon Polygon::convex_hull() const {
     
     // 按极角排序其余点
     Point p0 = points[0];
-    std::sort(points.begin() + 1, points.end(), [&p0](const Point& a, const Point& b) {
-        // 计算极角
-        float angle_a = std::atan2(a.y - p0.y, a.x - p0.x);
-        float angle_b = std::atan2(b.y - p0.y, b.x - p0.x);
-        
-        if (std::abs(angle_a - angle_b) < 1e-6f) {
-            // 如果极角相同，按距离排序
-            return p0.distance_to(a) < p0.distance_to(b);
-        }
-        
-        return angle_a < angle_b;
-    });
+    const bool exact = geometry::utils::predicate_policy() == geometry::utils::PredicatePolicy::Exact;
+    if (exact) {
+        // 其余点都在 p0 上方（或同一水平线的右侧），极角比较可以直接用方向测试
+        std::sort(points.begin() + 1, points.end(), [&p0](const Point& a, const Point& b) {
+            const double side = geometry::utils::orient2d(p0, a, b);
+            if (side == 0.0) {
+                return p0.distance_to(a) < p0.distance_to(b);
+            }
+            return side > 0.0;
+        });
+    } else {
+        std::sort(points.begin() + 1, points.end(), [&p0](const Point& a, const Point& b) {
+            // 计算极角
+            float angle_a = std::atan2(a.y - p0.y, a.x - p0.x);
+            float angle_b = std::atan2(b.y - p0.y, b.x - p0.x);
+            
+            if (std::abs(angle_a - angle_b) < 1e-6f) {
+                // 如果极角相同，按距离排序
+                return p0.distance_to(a) < p0.distance_to(b);
+            }
+            
+            return angle_a < angle_b;
+        });
+    }
     
     // Graham扫描
     std::vector<Point> hull;
@@ -197,7 +227,7 @@ Polygon Polygon::convex_hull() const {
             Point p3 = points[i];
             
             // 计算叉积的z分量
-            float cross_z = (p2.x - p1.x) * (p3.y - p2.y) - (p2.y - p1.y) * (p3.x - p2.x);
+            const double cross_z = turn(p1, p2, p3, exact);
             
             // 如果不是左转，则弹出栈顶
             if (cross_z <= 0) {
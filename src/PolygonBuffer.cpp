@@ -0,0 +1,45 @@
+#include "geometry/PolygonBuffer.h"
+#include <stdexcept>
+
+void PolygonBuffer::clear() noexcept {
+    vertices.clear();
+    offsets.resize(1);
+    offsets[0] = 0;
+}
+
+std::size_t PolygonBuffer::size() const noexcept {
+    return offsets.empty() ? 0 : offsets.size() - 1;
+}
+
+bool PolygonBuffer::empty() const noexcept {
+    return size() == 0;
+}
+
+void PolygonBuffer::add_vertex(const Point& point) {
+    vertices.push_back(point);
+}
+
+void PolygonBuffer::close_polygon() {
+    offsets.push_back(vertices.size());
+}
+
+void PolygonBuffer::add_polygon(const Polygon& polygon) {
+    vertices.insert(vertices.end(), polygon.vertices.begin(), polygon.vertices.end());
+    close_polygon();
+}
+
+std::size_t PolygonBuffer::vertex_count(std::size_t index) const noexcept {
+    return offsets[index + 1] - offsets[index];
+}
+
+const Point* PolygonBuffer::data(std::size_t index) const noexcept {
+    return vertices.data() + offsets[index];
+}
+
+Polygon PolygonBuffer::polygon(std::size_t index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Polygon index out of range");
+    }
+    const Point* first = data(index);
+    return Polygon(std::vector<Point>(first, first + vertex_count(index)));
+}
@@ -0,0 +1,47 @@
+#include "geometry/PolygonWithHoles.h"
+
+PolygonWithHoles::PolygonWithHoles(const Polygon& outer) : outer(outer) {}
+
+PolygonWithHoles::PolygonWithHoles(const Polygon& outer, const std::vector<Polygon>& holes)
+    : outer(outer), holes(holes) {}
+
+void PolygonWithHoles::add_hole(const Polygon& hole) {
+    holes.push_back(hole);
+}
+
+float PolygonWithHoles::area() const noexcept {
+    float result = outer.area();
+    for (const auto& hole : holes) {
+        result -= hole.area();
+    }
+    return result;
+}
+
+float PolygonWithHoles::perimeter() const noexcept {
+    float result = outer.perimeter();
+    for (const auto& hole : holes) {
+        result += hole.perimeter();
+    }
+    return result;
+}
+
+bool PolygonWithHoles::contains_point(const Point& point, bool include_boundary) const noexcept {
+    if (!outer.contains_point(point, include_boundary)) {
+        return false;
+    }
+    for (const auto& hole : holes) {
+        // 洞的边界属于区域的边界：include_boundary 为 true 时洞边界上的点算在区域内
+        if (hole.contains_point(point, !include_boundary)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::size_t PolygonWithHoles::vertex_count() const noexcept {
+    std::size_t count = outer.vertices.size();
+    for (const auto& hole : holes) {
+        count += hole.vertices.size();
+    }
+    return count;
+}
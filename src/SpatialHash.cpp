@@ -0,0 +1,359 @@
+#include "geometry/SpatialHash.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+// 单元格坐标限制在 int32 范围内，超出范围的点归入边界单元格
+inline std::int32_t to_cell(float value, float inv_size) noexcept {
+    const float c = std::floor(value * inv_size);
+    return static_cast<std::int32_t>(std::clamp(c, -2147483520.0f, 2147483520.0f));
+}
+
+inline std::size_t hash_cell(std::int32_t x, std::int32_t y, std::int32_t z) noexcept {
+    std::uint64_t h = static_cast<std::uint32_t>(x) * 0x9E3779B97F4A7C15ULL;
+    h ^= static_cast<std::uint32_t>(y) * 0xC2B2AE3D27D4EB4FULL;
+    h ^= static_cast<std::uint32_t>(z) * 0x165667B19E3779F9ULL;
+    return static_cast<std::size_t>(h ^ (h >> 29));
+}
+
+// 容纳 count 个单元格所需的表大小：2 的幂，装载率不超过 1/4，便于之后继续插入
+inline std::size_t table_capacity(std::size_t count) noexcept {
+    std::size_t capacity = 16;
+    while (capacity < std::max(count, std::size_t{8}) * 4) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+} // namespace
+
+SpatialHash::SpatialHash(float cell_size) : cell_size_(cell_size), inv_cell_size_(0.0f) {
+    if (!(cell_size > 0.0f) || !std::isfinite(cell_size)) {
+        throw std::invalid_argument("Spatial hash cell size must be positive");
+    }
+    inv_cell_size_ = 1.0f / cell_size;
+    cells_.resize(16);
+}
+
+float SpatialHash::cell_size() const noexcept {
+    return cell_size_;
+}
+
+std::size_t SpatialHash::size() const noexcept {
+    return count_;
+}
+
+bool SpatialHash::empty() const noexcept {
+    return count_ == 0;
+}
+
+void SpatialHash::clear() noexcept {
+    // 递增版本号即可让所有单元格失效，无需遍历整张表
+    if (++generation_ == 0) {
+        for (auto& cell : cells_) {
+            cell.generation = 0;
+        }
+        generation_ = 1;
+    }
+    cells_used_ = 0;
+    positions_.clear();
+    cell_of_slot_.clear();
+    next_.clear();
+    prev_.clear();
+    id_of_slot_.clear();
+    free_slots_.clear();
+    slot_of_id_.clear();
+    free_ids_.clear();
+    count_ = 0;
+}
+
+void SpatialHash::rebuild(const std::vector<Point>& points) {
+    const std::size_t n = points.size();
+    if (n >= kNone) {
+        throw std::length_error("Too many points for spatial hash");
+    }
+
+    clear();
+    // 表只在插入时增长。点数大幅减少时按当前点数重新分配，否则之后每次重建都要扫描历史上最大的表
+    const std::size_t capacity = table_capacity(n);
+    if (cells_.size() > 2 * capacity) {
+        cells_.assign(capacity, Cell{});
+        generation_ = 1;
+    }
+    reserve_cells(n);
+    positions_.resize(n);
+    cell_of_slot_.resize(n);
+    next_.resize(n);
+    prev_.resize(n);
+    id_of_slot_.resize(n);
+    slot_of_id_.resize(n);
+
+    // 第一遍：确定每个点的单元格并计数，暂时借用 slot_of_id_ 存放单元格下标
+    for (std::size_t i = 0; i < n; ++i) {
+        std::int32_t x, y, z;
+        cell_coords(points[i], x, y, z);
+        const std::uint32_t cell = acquire_cell(x, y, z);
+        ++cells_[cell].count;
+        slot_of_id_[i] = cell;
+    }
+
+    // 按单元格下标求前缀和（计数排序的键即单元格在表中的下标）：head 暂存每个单元格下一个待写入的槽位。
+    // 上面的重新分配保证表的大小小于 16 * max(n, 8)，扫描整张表仍是线性的
+    std::uint32_t offset = 0;
+    for (auto& cell : cells_) {
+        if (cell.generation == generation_) {
+            cell.head = offset;
+            offset += cell.count;
+        }
+    }
+
+    // 第二遍：按单元格顺序写入存储槽位
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::uint32_t cell = slot_of_id_[i];
+        const std::uint32_t slot = cells_[cell].head++;
+        positions_[slot] = points[i];
+        cell_of_slot_[slot] = cell;
+        id_of_slot_[slot] = static_cast<Id>(i);
+        slot_of_id_[i] = slot;
+    }
+
+    // 连续槽位串成链表，并把 head 恢复为每个单元格的首槽位
+    for (auto& c : cells_) {
+        if (c.generation != generation_) {
+            continue;
+        }
+        const std::uint32_t begin = c.head - c.count;
+        c.head = begin;
+        for (std::uint32_t s = begin; s < begin + c.count; ++s) {
+            prev_[s] = s == begin ? kNone : s - 1;
+            next_[s] = s + 1 == begin + c.count ? kNone : s + 1;
+        }
+    }
+    count_ = n;
+}
+
+SpatialHash::Id SpatialHash::insert(const Point& point) {
+    if (count_ + 1 >= kNone) {
+        throw std::length_error("Too many points for spatial hash");
+    }
+
+    std::uint32_t slot;
+    if (!free_slots_.empty()) {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+        positions_[slot] = point;
+    } else {
+        slot = static_cast<std::uint32_t>(positions_.size());
+        positions_.push_back(point);
+        cell_of_slot_.push_back(kNone);
+        next_.push_back(kNone);
+        prev_.push_back(kNone);
+        id_of_slot_.push_back(0);
+    }
+
+    Id id;
+    if (!free_ids_.empty()) {
+        id = free_ids_.back();
+        free_ids_.pop_back();
+        slot_of_id_[id] = slot;
+    } else {
+        id = static_cast<Id>(slot_of_id_.size());
+        slot_of_id_.push_back(slot);
+    }
+    id_of_slot_[slot] = id;
+
+    reserve_cells(cells_used_ + 1);
+    std::int32_t x, y, z;
+    cell_coords(point, x, y, z);
+    link(slot, acquire_cell(x, y, z));
+    ++count_;
+    return id;
+}
+
+void SpatialHash::remove(Id id) {
+    const std::uint32_t slot = checked_slot(id);
+    unlink(slot);
+    free_slots_.push_back(slot);
+    slot_of_id_[id] = kNone;
+    free_ids_.push_back(id);
+    --count_;
+}
+
+void SpatialHash::move(Id id, const Point& point) {
+    const std::uint32_t slot = checked_slot(id);
+    positions_[slot] = point;
+
+    std::int32_t x, y, z;
+    cell_coords(point, x, y, z);
+    const Cell& current = cells_[cell_of_slot_[slot]];
+    if (current.x == x && current.y == y && current.z == z) {
+        return;
+    }
+    unlink(slot);
+    reserve_cells(cells_used_ + 1);
+    link(slot, acquire_cell(x, y, z));
+}
+
+bool SpatialHash::contains(Id id) const noexcept {
+    return id < slot_of_id_.size() && slot_of_id_[id] != kNone;
+}
+
+const Point& SpatialHash::position(Id id) const {
+    return positions_[checked_slot(id)];
+}
+
+void SpatialHash::query_radius(const Point& center, float radius, std::vector<Id>& out) const {
+    out.clear();
+    if (count_ == 0 || !(radius >= 0.0f)) {
+        return;
+    }
+
+    const double r_sq = static_cast<double>(radius) * radius;
+    const auto visit = [&](const Cell& cell) {
+        for (std::uint32_t s = cell.head; s != kNone; s = next_[s]) {
+            const Point& p = positions_[s];
+            const double dx = static_cast<double>(p.x) - center.x;
+            const double dy = static_cast<double>(p.y) - center.y;
+            const double dz = static_cast<double>(p.z) - center.z;
+            if (dx * dx + dy * dy + dz * dz <= r_sq) {
+                out.push_back(id_of_slot_[s]);
+            }
+        }
+    };
+
+    std::int32_t lo[3], hi[3];
+    cell_coords(Point(center.x - radius, center.y - radius, center.z - radius), lo[0], lo[1], lo[2]);
+    cell_coords(Point(center.x + radius, center.y + radius, center.z + radius), hi[0], hi[1], hi[2]);
+    const double range = (static_cast<double>(hi[0]) - lo[0] + 1.0) * (static_cast<double>(hi[1]) - lo[1] + 1.0)
+                         * (static_cast<double>(hi[2]) - lo[2] + 1.0);
+
+    if (range > static_cast<double>(cells_.size())) {
+        // 查询范围覆盖的单元格比表还多：直接扫描所有已占用的单元格
+        for (const auto& cell : cells_) {
+            if (cell.generation == generation_ && cell.count > 0 && cell.x >= lo[0] && cell.x <= hi[0]
+                && cell.y >= lo[1] && cell.y <= hi[1] && cell.z >= lo[2] && cell.z <= hi[2]) {
+                visit(cell);
+            }
+        }
+        return;
+    }
+
+    for (std::int32_t z = lo[2]; z <= hi[2]; ++z) {
+        for (std::int32_t y = lo[1]; y <= hi[1]; ++y) {
+            for (std::int32_t x = lo[0]; x <= hi[0]; ++x) {
+                const std::uint32_t cell = find_cell(x, y, z);
+                if (cell != kNone) {
+                    visit(cells_[cell]);
+                }
+            }
+        }
+    }
+}
+
+std::vector<SpatialHash::Id> SpatialHash::query_radius(const Point& center, float radius) const {
+    std::vector<Id> out;
+    query_radius(center, radius, out);
+    return out;
+}
+
+void SpatialHash::cell_coords(const Point& point, std::int32_t& x, std::int32_t& y, std::int32_t& z) const noexcept {
+    x = to_cell(point.x, inv_cell_size_);
+    y = to_cell(point.y, inv_cell_size_);
+    z = to_cell(point.z, inv_cell_size_);
+}
+
+std::uint32_t SpatialHash::find_cell(std::int32_t x, std::int32_t y, std::int32_t z) const noexcept {
+    const std::size_t mask = cells_.size() - 1;
+    for (std::size_t i = hash_cell(x, y, z) & mask;; i = (i + 1) & mask) {
+        const Cell& cell = cells_[i];
+        if (cell.generation != generation_) {
+            return kNone;
+        }
+        if (cell.x == x && cell.y == y && cell.z == z) {
+            return static_cast<std::uint32_t>(i);
+        }
+    }
+}
+
+std::uint32_t SpatialHash::acquire_cell(std::int32_t x, std::int32_t y, std::int32_t z) {
+    const std::size_t mask = cells_.size() - 1;
+    for (std::size_t i = hash_cell(x, y, z) & mask;; i = (i + 1) & mask) {
+        Cell& cell = cells_[i];
+        if (cell.generation != generation_) {
+            cell = Cell{x, y, z, kNone, 0, generation_};
+            ++cells_used_;
+            return static_cast<std::uint32_t>(i);
+        }
+        if (cell.x == x && cell.y == y && cell.z == z) {
+            return static_cast<std::uint32_t>(i);
+        }
+    }
+}
+
+void SpatialHash::reserve_cells(std::size_t count) {
+    // 保持装载率不超过 1/2；空单元格不会被删除，在重新散列时统一清理
+    if (count * 2 <= cells_.size()) {
+        return;
+    }
+    std::size_t live = 0;
+    for (const auto& cell : cells_) {
+        if (cell.generation == generation_ && cell.count > 0) {
+            ++live;
+        }
+    }
+    rehash(table_capacity(count - cells_used_ + live));
+}
+
+void SpatialHash::rehash(std::size_t capacity) {
+    std::vector<Cell> old(capacity);
+    old.swap(cells_);
+    const std::uint32_t old_generation = generation_;
+    generation_ = 1;
+    cells_used_ = 0;
+
+    for (const auto& cell : old) {
+        if (cell.generation != old_generation || cell.count == 0) {
+            continue;
+        }
+        const std::uint32_t index = acquire_cell(cell.x, cell.y, cell.z);
+        cells_[index].head = cell.head;
+        cells_[index].count = cell.count;
+        for (std::uint32_t s = cell.head; s != kNone; s = next_[s]) {
+            cell_of_slot_[s] = index;
+        }
+    }
+}
+
+void SpatialHash::link(std::uint32_t slot, std::uint32_t cell) noexcept {
+    Cell& c = cells_[cell];
+    prev_[slot] = kNone;
+    next_[slot] = c.head;
+    if (c.head != kNone) {
+        prev_[c.head] = slot;
+    }
+    c.head = slot;
+    ++c.count;
+    cell_of_slot_[slot] = cell;
+}
+
+void SpatialHash::unlink(std::uint32_t slot) noexcept {
+    Cell& c = cells_[cell_of_slot_[slot]];
+    if (prev_[slot] != kNone) {
+        next_[prev_[slot]] = next_[slot];
+    } else {
+        c.head = next_[slot];
+    }
+    if (next_[slot] != kNone) {
+        prev_[next_[slot]] = prev_[slot];
+    }
+    --c.count;
+}
+
+std::uint32_t SpatialHash::checked_slot(Id id) const {
+    if (!contains(id)) {
+        throw std::out_of_range("Invalid spatial hash id");
+    }
+    return slot_of_id_[id];
+}
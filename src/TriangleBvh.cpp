@@ -0,0 +1,697 @@
+#include "geometry/TriangleBvh.h"
+#include "utils/parallel.h"
+#include "utils/raycast.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+using Node = TriangleBvh::Node;
+
+// 超过这个深度后改用按中位数平分，保证遍历栈不会溢出
+constexpr std::size_t kMaxSahDepth = 48;
+constexpr std::size_t kStackSize = 128;
+// 包围盒求交的远端参数放大 1 + 2γ3（Ize 2013），舍入误差不会让射线漏掉恰好擦过包围盒的三角形
+constexpr float kFarScale = 1.0f + 4.0f * std::numeric_limits<float>::epsilon();
+// 与当前最近交点比较时把上界放宽同样的比例：近端参数的舍入误差不会剪掉含有参数相同、下标更小的三角形的节点
+constexpr float kTieSlack = 4.0f * std::numeric_limits<float>::epsilon();
+constexpr std::size_t kRayChunk = 1 << 10;
+
+// 待构建的子树
+struct BuildTask {
+    std::uint32_t parent = TriangleBvh::kNoTriangle;
+    std::uint32_t begin = 0;
+    std::uint32_t end = 0;
+    std::size_t depth = 1;
+};
+
+inline BoundingBox empty_box() noexcept {
+    const float inf = std::numeric_limits<float>::infinity();
+    return BoundingBox(Point(inf, inf, inf), Point(-inf, -inf, -inf));
+}
+
+inline void merge(BoundingBox& box, const BoundingBox& other) noexcept {
+    box.expand(other.min);
+    box.expand(other.max);
+}
+
+// 节点包围盒按坐标量级向外扩展几个 ulp：求交算法的舍入误差可能让射线在包围盒之外“命中”三角形的顶点或边，
+// 扩展后这些交点也会被访问到，参数相同时仍取下标最小的三角形
+inline void pad(BoundingBox& box) noexcept {
+    constexpr float kRelative = 8.0f * std::numeric_limits<float>::epsilon();
+    const float magnitude = std::max({std::abs(box.min.x), std::abs(box.min.y), std::abs(box.min.z),
+                                      std::abs(box.max.x), std::abs(box.max.y), std::abs(box.max.z)});
+    const float margin = magnitude * kRelative;
+    box.min = box.min - Point(margin, margin, margin);
+    box.max = box.max + Point(margin, margin, margin);
+}
+
+inline float surface_area(const BoundingBox& box) noexcept {
+    const float x = box.max.x - box.min.x, y = box.max.y - box.min.y, z = box.max.z - box.min.z;
+    return (x < 0.0f || y < 0.0f || z < 0.0f) ? 0.0f : 2.0f * (x * y + y * z + z * x);
+}
+
+inline float axis_value(const Point& p, int axis) noexcept {
+    return axis == 0 ? p.x : axis == 1 ? p.y : p.z;
+}
+
+// 方向分量为0时用一个极小值代替，避免 0 * inf 产生 NaN
+inline float safe_inverse(float d) noexcept {
+    constexpr float kTiny = 1e-30f;
+    return 1.0f / (std::abs(d) < kTiny ? std::copysign(kTiny, d) : d);
+}
+
+inline bool box_hit(const BoundingBox& box, const float (&o)[3], const float (&inv)[3], float t_min,
+                    float t_max) noexcept {
+    const float t0x = (box.min.x - o[0]) * inv[0], t1x = (box.max.x - o[0]) * inv[0];
+    const float t0y = (box.min.y - o[1]) * inv[1], t1y = (box.max.y - o[1]) * inv[1];
+    const float t0z = (box.min.z - o[2]) * inv[2], t1z = (box.max.z - o[2]) * inv[2];
+    const float near = std::max(std::max(std::min(t0x, t1x), std::min(t0y, t1y)), std::max(std::min(t0z, t1z), t_min));
+    const float far = std::min(std::min(std::max(t0x, t1x), std::max(t0y, t1y)), std::max(t0z, t1z)) * kFarScale;
+    return near <= std::min(far, t_max * (t_max < 0.0f ? 1.0f - kTieSlack : 1.0f + kTieSlack));
+}
+
+inline std::optional<geometry::utils::RayTriangleHit> test_triangle(TriangleTest test, const Point& origin,
+                                                                    const Point& direction, const Point* tri,
+                                                                    float t_min, float t_max) noexcept {
+    return test == TriangleTest::Watertight
+               ? geometry::utils::ray_triangle_watertight(origin, direction, tri[0], tri[1], tri[2], t_min, t_max)
+               : geometry::utils::ray_triangle(origin, direction, tri[0], tri[1], tri[2], t_min, t_max);
+}
+
+// 单条射线的遍历：any_hit 为真时找到任意交点即返回
+bool traverse(const std::vector<Node>& nodes, const std::vector<Point>& corners,
+              const std::vector<std::uint32_t>& ids, const Point& origin, const Point& direction, float t_min,
+              float t_max, TriangleTest test, bool any_hit, TriangleHit& best) noexcept {
+    if (nodes.empty()) {
+        return false;
+    }
+    const float o[3] = {origin.x, origin.y, origin.z};
+    const float inv[3] = {safe_inverse(direction.x), safe_inverse(direction.y), safe_inverse(direction.z)};
+    const bool negative[3] = {direction.x < 0.0f, direction.y < 0.0f, direction.z < 0.0f};
+
+    std::uint32_t stack[kStackSize];
+    std::size_t top = 0;
+    stack[top++] = 0;
+    bool found = false;
+    while (top > 0) {
+        const Node& node = nodes[stack[--top]];
+        if (!box_hit(node.bounds, o, inv, t_min, found ? best.t : t_max)) {
+            continue;
+        }
+        if (node.count > 0) {
+            for (std::uint32_t k = node.offset; k < node.offset + node.count; ++k) {
+                const auto hit = test_triangle(test, origin, direction, &corners[3 * k], t_min, found ? best.t : t_max);
+                if (!hit) {
+                    continue;
+                }
+                // 参数相同时取下标较小的三角形，使结果与遍历顺序无关
+                if (!found || hit->t < best.t || (hit->t == best.t && ids[k] < best.triangle)) {
+                    best = TriangleHit{hit->t, hit->u, hit->v, ids[k]};
+                    found = true;
+                    if (any_hit) {
+                        return true;
+                    }
+                }
+            }
+            continue;
+        }
+        const auto self = static_cast<std::uint32_t>(&node - nodes.data());
+        // 先压远侧子节点，近侧子节点先出栈
+        if (negative[node.axis]) {
+            stack[top++] = self + 1;
+            stack[top++] = node.offset;
+        } else {
+            stack[top++] = node.offset;
+            stack[top++] = self + 1;
+        }
+    }
+    return found;
+}
+
+#if defined(__SSE2__)
+inline __m128 select(__m128 mask, __m128 a, __m128 b) noexcept {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+inline __m128i select(__m128i mask, __m128i a, __m128i b) noexcept {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// movemask 的逆运算：第 l 位为1的通道全为1
+inline __m128 lane_mask(int bits) noexcept {
+    return _mm_castsi128_ps(_mm_setr_epi32(-(bits & 1), -((bits >> 1) & 1), -((bits >> 2) & 1), -((bits >> 3) & 1)));
+}
+
+// 4条射线组成的包；末尾不足4条时补上的通道 t_min = +inf、t_max = -inf，永远不会命中
+struct Packet {
+    Point origin[4], direction[4];
+    __m128 ox, oy, oz, dx, dy, dz;
+    __m128 ix, iy, iz;
+    __m128 t_min, t_max;
+    bool negative[3];
+    // 水密算法的逐通道剪切变换与坐标轴置换掩码
+    __m128 shear_x, shear_y, shear_z;
+    __m128 kx0, kx1, ky0, ky1, kz0, kz1;
+
+    Packet(const Point* origins, const Point* directions, std::size_t count, float lo, float hi, TriangleTest test) {
+        float tmin[4], tmax[4], sx[4], sy[4], sz[4];
+        int kx[4], ky[4], kz[4];
+        for (std::size_t l = 0; l < 4; ++l) {
+            const std::size_t i = std::min(l, count - 1);
+            origin[l] = origins[i];
+            direction[l] = directions[i];
+            tmin[l] = l < count ? lo : std::numeric_limits<float>::infinity();
+            tmax[l] = l < count ? hi : -std::numeric_limits<float>::infinity();
+            // 与 ray_triangle_watertight 相同的轴选择与剪切系数
+            const float d[3] = {direction[l].x, direction[l].y, direction[l].z};
+            int z = 0;
+            if (std::abs(d[1]) > std::abs(d[z])) {
+                z = 1;
+            }
+            if (std::abs(d[2]) > std::abs(d[z])) {
+                z = 2;
+            }
+            int x = (z + 1) % 3;
+            int y = (x + 1) % 3;
+            if (d[z] < 0.0f) {
+                std::swap(x, y);
+            }
+            kx[l] = x;
+            ky[l] = y;
+            kz[l] = z;
+            sx[l] = d[x] / d[z];
+            sy[l] = d[y] / d[z];
+            sz[l] = 1.0f / d[z];
+        }
+        ox = _mm_setr_ps(origin[0].x, origin[1].x, origin[2].x, origin[3].x);
+        oy = _mm_setr_ps(origin[0].y, origin[1].y, origin[2].y, origin[3].y);
+        oz = _mm_setr_ps(origin[0].z, origin[1].z, origin[2].z, origin[3].z);
+        dx = _mm_setr_ps(direction[0].x, direction[1].x, direction[2].x, direction[3].x);
+        dy = _mm_setr_ps(direction[0].y, direction[1].y, direction[2].y, direction[3].y);
+        dz = _mm_setr_ps(direction[0].z, direction[1].z, direction[2].z, direction[3].z);
+        ix = _mm_setr_ps(safe_inverse(direction[0].x), safe_inverse(direction[1].x), safe_inverse(direction[2].x),
+                         safe_inverse(direction[3].x));
+        iy = _mm_setr_ps(safe_inverse(direction[0].y), safe_inverse(direction[1].y), safe_inverse(direction[2].y),
+                         safe_inverse(direction[3].y));
+        iz = _mm_setr_ps(safe_inverse(direction[0].z), safe_inverse(direction[1].z), safe_inverse(direction[2].z),
+                         safe_inverse(direction[3].z));
+        t_min = _mm_loadu_ps(tmin);
+        t_max = _mm_loadu_ps(tmax);
+        // 子节点的访问顺序按包内方向之和决定
+        const float sum[3] = {direction[0].x + direction[1].x + direction[2].x + direction[3].x,
+                              direction[0].y + direction[1].y + direction[2].y + direction[3].y,
+                              direction[0].z + direction[1].z + direction[2].z + direction[3].z};
+        for (int a = 0; a < 3; ++a) {
+            negative[a] = sum[a] < 0.0f;
+        }
+        if (test == TriangleTest::Watertight) {
+            shear_x = _mm_loadu_ps(sx);
+            shear_y = _mm_loadu_ps(sy);
+            shear_z = _mm_loadu_ps(sz);
+            const auto mask = [](const int (&k)[4], int value) {
+                return _mm_castsi128_ps(_mm_setr_epi32(-(k[0] == value), -(k[1] == value), -(k[2] == value),
+                                                       -(k[3] == value)));
+            };
+            kx0 = mask(kx, 0);
+            kx1 = mask(kx, 1);
+            ky0 = mask(ky, 0);
+            ky1 = mask(ky, 1);
+            kz0 = mask(kz, 0);
+            kz1 = mask(kz, 1);
+        }
+    }
+};
+
+// 与 box_hit 相同的运算，返回4条射线中与包围盒相交的通道掩码
+inline int box_hit4(const BoundingBox& box, const Packet& p, __m128 t_max) noexcept {
+    const __m128 t0x = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.min.x), p.ox), p.ix);
+    const __m128 t1x = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.max.x), p.ox), p.ix);
+    const __m128 t0y = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.min.y), p.oy), p.iy);
+    const __m128 t1y = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.max.y), p.oy), p.iy);
+    const __m128 t0z = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.min.z), p.oz), p.iz);
+    const __m128 t1z = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.max.z), p.oz), p.iz);
+    const __m128 near = _mm_max_ps(_mm_max_ps(_mm_min_ps(t0x, t1x), _mm_min_ps(t0y, t1y)),
+                                   _mm_max_ps(_mm_min_ps(t0z, t1z), p.t_min));
+    const __m128 far = _mm_mul_ps(_mm_min_ps(_mm_min_ps(_mm_max_ps(t0x, t1x), _mm_max_ps(t0y, t1y)), _mm_max_ps(t0z, t1z)),
+                                  _mm_set1_ps(kFarScale));
+    // 无效通道的 t_max 为 -inf，按比例缩放后仍为 -inf
+    const __m128 scale = select(_mm_cmplt_ps(t_max, _mm_setzero_ps()), _mm_set1_ps(1.0f - kTieSlack),
+                                _mm_set1_ps(1.0f + kTieSlack));
+    const __m128 limit = _mm_mul_ps(t_max, scale);
+    return _mm_movemask_ps(_mm_cmple_ps(near, _mm_min_ps(far, limit)));
+}
+
+// 与 ray_triangle 相同的运算顺序，4条射线同时对一个三角形求交
+inline __m128 moller_trumbore4(const Packet& p, const Point* tri, __m128 t_max, __m128& t, __m128& u,
+                               __m128& v) noexcept {
+    const Point& a = tri[0];
+    const __m128 e1x = _mm_set1_ps(tri[1].x - a.x), e1y = _mm_set1_ps(tri[1].y - a.y), e1z = _mm_set1_ps(tri[1].z - a.z);
+    const __m128 e2x = _mm_set1_ps(tri[2].x - a.x), e2y = _mm_set1_ps(tri[2].y - a.y), e2z = _mm_set1_ps(tri[2].z - a.z);
+    const __m128 px = _mm_sub_ps(_mm_mul_ps(p.dy, e2z), _mm_mul_ps(p.dz, e2y));
+    const __m128 py = _mm_sub_ps(_mm_mul_ps(p.dz, e2x), _mm_mul_ps(p.dx, e2z));
+    const __m128 pz = _mm_sub_ps(_mm_mul_ps(p.dx, e2y), _mm_mul_ps(p.dy, e2x));
+    const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+    const __m128 inv = _mm_div_ps(_mm_set1_ps(1.0f), det);
+    const __m128 sx = _mm_sub_ps(p.ox, _mm_set1_ps(a.x));
+    const __m128 sy = _mm_sub_ps(p.oy, _mm_set1_ps(a.y));
+    const __m128 sz = _mm_sub_ps(p.oz, _mm_set1_ps(a.z));
+    u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)), inv);
+    const __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+    const __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+    const __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+    v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(p.dx, qx), _mm_mul_ps(p.dy, qy)), _mm_mul_ps(p.dz, qz)), inv);
+    t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), inv);
+
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 nonzero = _mm_or_ps(_mm_cmplt_ps(det, zero), _mm_cmpgt_ps(det, zero));
+    const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmpge_ps(v, zero)),
+                                     _mm_cmple_ps(_mm_add_ps(u, v), _mm_set1_ps(1.0f)));
+    const __m128 range = _mm_and_ps(_mm_cmpge_ps(t, p.t_min), _mm_cmple_ps(t, t_max));
+    return _mm_and_ps(_mm_and_ps(nonzero, inside), range);
+}
+
+// 按逐通道的置换掩码取出第 k 个坐标
+inline __m128 permute(__m128 x, __m128 y, __m128 z, __m128 is0, __m128 is1) noexcept {
+    return select(is0, x, select(is1, y, z));
+}
+
+// 与 ray_triangle_watertight 相同的运算顺序；边函数恰好为0的通道交给标量版本用双精度重算
+inline __m128 watertight4(const Packet& p, const Point* tri, __m128 t_max, __m128& t, __m128& u,
+                          __m128& v) noexcept {
+    __m128 A[3], B[3], C[3];
+    A[0] = _mm_sub_ps(_mm_set1_ps(tri[0].x), p.ox);
+    A[1] = _mm_sub_ps(_mm_set1_ps(tri[0].y), p.oy);
+    A[2] = _mm_sub_ps(_mm_set1_ps(tri[0].z), p.oz);
+    B[0] = _mm_sub_ps(_mm_set1_ps(tri[1].x), p.ox);
+    B[1] = _mm_sub_ps(_mm_set1_ps(tri[1].y), p.oy);
+    B[2] = _mm_sub_ps(_mm_set1_ps(tri[1].z), p.oz);
+    C[0] = _mm_sub_ps(_mm_set1_ps(tri[2].x), p.ox);
+    C[1] = _mm_sub_ps(_mm_set1_ps(tri[2].y), p.oy);
+    C[2] = _mm_sub_ps(_mm_set1_ps(tri[2].z), p.oz);
+    const __m128 akz = permute(A[0], A[1], A[2], p.kz0, p.kz1);
+    const __m128 bkz = permute(B[0], B[1], B[2], p.kz0, p.kz1);
+    const __m128 ckz = permute(C[0], C[1], C[2], p.kz0, p.kz1);
+    const __m128 ax = _mm_sub_ps(permute(A[0], A[1], A[2], p.kx0, p.kx1), _mm_mul_ps(p.shear_x, akz));
+    const __m128 ay = _mm_sub_ps(permute(A[0], A[1], A[2], p.ky0, p.ky1), _mm_mul_ps(p.shear_y, akz));
+    const __m128 bx = _mm_sub_ps(permute(B[0], B[1], B[2], p.kx0, p.kx1), _mm_mul_ps(p.shear_x, bkz));
+    const __m128 by = _mm_sub_ps(permute(B[0], B[1], B[2], p.ky0, p.ky1), _mm_mul_ps(p.shear_y, bkz));
+    const __m128 cx = _mm_sub_ps(permute(C[0], C[1], C[2], p.kx0, p.kx1), _mm_mul_ps(p.shear_x, ckz));
+    const __m128 cy = _mm_sub_ps(permute(C[0], C[1], C[2], p.ky0, p.ky1), _mm_mul_ps(p.shear_y, ckz));
+
+    const __m128 U = _mm_sub_ps(_mm_mul_ps(cx, by), _mm_mul_ps(cy, bx));
+    const __m128 V = _mm_sub_ps(_mm_mul_ps(ax, cy), _mm_mul_ps(ay, cx));
+    const __m128 W = _mm_sub_ps(_mm_mul_ps(bx, ay), _mm_mul_ps(by, ax));
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 negative = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(U, zero), _mm_cmplt_ps(V, zero)), _mm_cmplt_ps(W, zero));
+    const __m128 positive = _mm_or_ps(_mm_or_ps(_mm_cmpgt_ps(U, zero), _mm_cmpgt_ps(V, zero)), _mm_cmpgt_ps(W, zero));
+    const __m128 det = _mm_add_ps(_mm_add_ps(U, V), W);
+    const __m128 T = _mm_add_ps(_mm_add_ps(_mm_mul_ps(U, _mm_mul_ps(p.shear_z, akz)), _mm_mul_ps(V, _mm_mul_ps(p.shear_z, bkz))),
+                                _mm_mul_ps(W, _mm_mul_ps(p.shear_z, ckz)));
+    const __m128 inv = _mm_div_ps(_mm_set1_ps(1.0f), det);
+    t = _mm_mul_ps(T, inv);
+    u = _mm_mul_ps(V, inv);
+    v = _mm_mul_ps(W, inv);
+    const __m128 nonzero = _mm_or_ps(_mm_cmplt_ps(det, zero), _mm_cmpgt_ps(det, zero));
+    const __m128 range = _mm_and_ps(_mm_cmpge_ps(t, p.t_min), _mm_cmple_ps(t, t_max));
+    __m128 hit = _mm_and_ps(_mm_andnot_ps(_mm_and_ps(negative, positive), nonzero), range);
+
+    const __m128 degenerate = _mm_or_ps(_mm_or_ps(_mm_cmpeq_ps(U, zero), _mm_cmpeq_ps(V, zero)), _mm_cmpeq_ps(W, zero));
+    const int fallback = _mm_movemask_ps(_mm_and_ps(degenerate, _mm_cmple_ps(p.t_min, t_max)));
+    if (fallback != 0) {
+        alignas(16) float lanes_t[4], lanes_u[4], lanes_v[4], lower[4], upper[4];
+        alignas(16) std::int32_t lanes_hit[4];
+        _mm_store_ps(lanes_t, t);
+        _mm_store_ps(lanes_u, u);
+        _mm_store_ps(lanes_v, v);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes_hit), _mm_castps_si128(hit));
+        _mm_store_ps(lower, p.t_min);
+        _mm_store_ps(upper, t_max);
+        for (int l = 0; l < 4; ++l) {
+            if (((fallback >> l) & 1) == 0) {
+                continue;
+            }
+            const auto result = geometry::utils::ray_triangle_watertight(p.origin[l], p.direction[l], tri[0], tri[1],
+                                                                         tri[2], lower[l], upper[l]);
+            lanes_hit[l] = result ? -1 : 0;
+            if (result) {
+                lanes_t[l] = result->t;
+                lanes_u[l] = result->u;
+                lanes_v[l] = result->v;
+            }
+        }
+        t = _mm_load_ps(lanes_t);
+        u = _mm_load_ps(lanes_u);
+        v = _mm_load_ps(lanes_v);
+        hit = _mm_castsi128_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(lanes_hit)));
+    }
+    return hit;
+}
+
+inline __m128 test_triangle4(TriangleTest test, const Packet& p, const Point* tri, __m128 t_max, __m128& t,
+                             __m128& u, __m128& v) noexcept {
+    return test == TriangleTest::Watertight ? watertight4(p, tri, t_max, t, u, v) : moller_trumbore4(p, tri, t_max, t, u, v);
+}
+#endif
+
+} // namespace
+
+TriangleBvh::TriangleBvh(const std::vector<Point>& vertices, const std::vector<std::uint32_t>& triangles,
+                         const BvhBuildOptions& options) {
+    build(vertices, triangles, options);
+}
+
+void TriangleBvh::build(const std::vector<Point>& vertices, const std::vector<std::uint32_t>& triangles,
+                        const BvhBuildOptions& options) {
+    if (triangles.size() % 3 != 0) {
+        throw std::invalid_argument("Triangle index count must be a multiple of 3");
+    }
+    if (options.max_leaf_size == 0 || options.max_leaf_size > std::numeric_limits<std::uint16_t>::max()) {
+        throw std::invalid_argument("BVH leaf size must be in [1, 65535]");
+    }
+    if (options.bins == 0) {
+        throw std::invalid_argument("BVH bin count must be positive");
+    }
+    const std::size_t count = triangles.size() / 3;
+    if (count >= kNoTriangle) {
+        throw std::length_error("Too many triangles for TriangleBvh");
+    }
+    for (std::uint32_t index : triangles) {
+        if (index >= vertices.size()) {
+            throw std::out_of_range("Triangle vertex index out of range");
+        }
+    }
+    nodes_.clear();
+    corners_.clear();
+    triangles_.clear();
+    depth_ = 0;
+    if (count == 0) {
+        return;
+    }
+
+    std::vector<BoundingBox> boxes(count, empty_box());
+    std::vector<Point> centroids(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            boxes[i].expand(vertices[triangles[3 * i + k]]);
+        }
+        centroids[i] = boxes[i].center();
+    }
+    std::vector<std::uint32_t> order(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        order[i] = static_cast<std::uint32_t>(i);
+    }
+
+    nodes_.reserve(2 * count);
+    corners_.reserve(3 * count);
+    triangles_.reserve(count);
+    const std::size_t bins = options.bins;
+    std::vector<BoundingBox> bin_boxes(bins);
+    std::vector<std::size_t> bin_counts(bins);
+    std::vector<float> right_areas(bins);
+
+    std::vector<BuildTask> stack;
+    stack.push_back(BuildTask{kNoTriangle, 0, static_cast<std::uint32_t>(count), 1});
+    while (!stack.empty()) {
+        const BuildTask task = stack.back();
+        stack.pop_back();
+        const auto index = static_cast<std::uint32_t>(nodes_.size());
+        nodes_.emplace_back();
+        if (task.parent != kNoTriangle) {
+            // 左子节点紧跟在父节点之后，只需记录右子节点
+            if (task.parent + 1 != index) {
+                nodes_[task.parent].offset = index;
+            }
+        }
+        depth_ = std::max(depth_, task.depth);
+
+        BoundingBox bounds = empty_box(), centroid_bounds = empty_box();
+        for (std::uint32_t i = task.begin; i < task.end; ++i) {
+            merge(bounds, boxes[order[i]]);
+            centroid_bounds.expand(centroids[order[i]]);
+        }
+        nodes_[index].bounds = bounds;
+        pad(nodes_[index].bounds);
+
+        const std::uint32_t n = task.end - task.begin;
+        if (n <= options.max_leaf_size) {
+            nodes_[index].offset = static_cast<std::uint32_t>(triangles_.size());
+            nodes_[index].count = static_cast<std::uint16_t>(n);
+            for (std::uint32_t i = task.begin; i < task.end; ++i) {
+                for (int k = 0; k < 3; ++k) {
+                    corners_.push_back(vertices[triangles[3 * order[i] + k]]);
+                }
+                triangles_.push_back(order[i]);
+            }
+            continue;
+        }
+
+        // 沿三个轴分桶，计算每个分割位置的 SAH 代价：左右两侧三角形数乘以各自包围盒的表面积
+        int best_axis = -1;
+        std::size_t best_bin = 0;
+        float best_cost = std::numeric_limits<float>::infinity();
+        if (task.depth < kMaxSahDepth) {
+            for (int axis = 0; axis < 3; ++axis) {
+                const float lo = axis_value(centroid_bounds.min, axis);
+                const float extent = axis_value(centroid_bounds.max, axis) - lo;
+                if (!(extent > 0.0f)) {
+                    continue;
+                }
+                const float scale = static_cast<float>(bins) / extent;
+                std::fill(bin_boxes.begin(), bin_boxes.end(), empty_box());
+                std::fill(bin_counts.begin(), bin_counts.end(), 0);
+                for (std::uint32_t i = task.begin; i < task.end; ++i) {
+                    const std::size_t b = std::min(bins - 1, static_cast<std::size_t>((axis_value(centroids[order[i]], axis) - lo) * scale));
+                    merge(bin_boxes[b], boxes[order[i]]);
+                    ++bin_counts[b];
+                }
+                BoundingBox right = empty_box();
+                for (std::size_t b = bins - 1; b > 0; --b) {
+                    merge(right, bin_boxes[b]);
+                    right_areas[b] = surface_area(right);
+                }
+                BoundingBox left = empty_box();
+                std::size_t left_count = 0;
+                for (std::size_t b = 0; b + 1 < bins; ++b) {
+                    merge(left, bin_boxes[b]);
+                    left_count += bin_counts[b];
+                    const float cost = static_cast<float>(left_count) * surface_area(left)
+                                       + static_cast<float>(n - left_count) * right_areas[b + 1];
+                    if (left_count > 0 && left_count < n && cost < best_cost) {
+                        best_cost = cost;
+                        best_axis = axis;
+                        best_bin = b;
+                    }
+                }
+            }
+        }
+
+        std::uint32_t middle;
+        int split_axis = best_axis;
+        if (best_axis >= 0) {
+            const float lo = axis_value(centroid_bounds.min, best_axis);
+            const float scale = static_cast<float>(bins) / (axis_value(centroid_bounds.max, best_axis) - lo);
+            const auto it = std::partition(order.begin() + task.begin, order.begin() + task.end, [&](std::uint32_t t) {
+                return std::min(bins - 1, static_cast<std::size_t>((axis_value(centroids[t], best_axis) - lo) * scale)) <= best_bin;
+            });
+            middle = static_cast<std::uint32_t>(it - order.begin());
+        } else {
+            // 质心重合或树已经太深：沿质心范围最大的轴按中位数平分
+            const Point extent = centroid_bounds.max - centroid_bounds.min;
+            split_axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : extent.y >= extent.z ? 1 : 2;
+            middle = task.begin + n / 2;
+            std::nth_element(order.begin() + task.begin, order.begin() + middle, order.begin() + task.end,
+                             [&](std::uint32_t a, std::uint32_t b) {
+                                 return axis_value(centroids[a], split_axis) < axis_value(centroids[b], split_axis);
+                             });
+        }
+        nodes_[index].axis = static_cast<std::uint16_t>(split_axis);
+        // 先压右侧再压左侧，左子节点紧跟在当前节点之后
+        stack.push_back(BuildTask{index, middle, task.end, task.depth + 1});
+        stack.push_back(BuildTask{index, task.begin, middle, task.depth + 1});
+    }
+}
+
+bool TriangleBvh::empty() const noexcept {
+    return nodes_.empty();
+}
+
+std::size_t TriangleBvh::triangle_count() const noexcept {
+    return triangles_.size();
+}
+
+const std::vector<TriangleBvh::Node>& TriangleBvh::nodes() const noexcept {
+    return nodes_;
+}
+
+std::size_t TriangleBvh::depth() const noexcept {
+    return depth_;
+}
+
+std::optional<TriangleHit> TriangleBvh::intersect(const Point& origin, const Point& direction, float t_min,
+                                                  float t_max, TriangleTest test) const noexcept {
+    TriangleHit hit;
+    if (traverse(nodes_, corners_, triangles_, origin, direction, t_min, t_max, test, false, hit)) {
+        return hit;
+    }
+    return std::nullopt;
+}
+
+bool TriangleBvh::occluded(const Point& origin, const Point& direction, float t_min, float t_max,
+                           TriangleTest test) const noexcept {
+    TriangleHit hit;
+    return traverse(nodes_, corners_, triangles_, origin, direction, t_min, t_max, test, true, hit);
+}
+
+std::size_t TriangleBvh::intersect(const Point* origins, const Point* directions, std::size_t count,
+                                   TriangleHit* out, float t_min, float t_max, TriangleTest test) const {
+    std::atomic<std::size_t> total{0};
+    geometry::utils::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+        std::size_t hits = 0;
+#if defined(__SSE2__)
+        for (std::size_t r = begin; r < end; r += 4) {
+            const std::size_t lanes = std::min<std::size_t>(4, end - r);
+            for (std::size_t l = 0; l < lanes; ++l) {
+                out[r + l] = TriangleHit{};
+            }
+            if (nodes_.empty()) {
+                continue;
+            }
+            const Packet packet(origins + r, directions + r, lanes, t_min, t_max, test);
+            __m128 best_t = packet.t_max;
+            __m128 best_u = _mm_setzero_ps(), best_v = _mm_setzero_ps();
+            __m128i best_id = _mm_set1_epi32(static_cast<int>(kNoTriangle));
+            const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+
+            std::uint32_t stack[kStackSize];
+            std::size_t top = 0;
+            stack[top++] = 0;
+            while (top > 0) {
+                const std::uint32_t self = stack[--top];
+                const Node& node = nodes_[self];
+                const int active = box_hit4(node.bounds, packet, best_t);
+                if (active == 0) {
+                    continue;
+                }
+                if (node.count > 0) {
+                    // 只接受与叶子包围盒相交的通道，与单条射线的遍历保持一致
+                    const __m128 inside = lane_mask(active);
+                    for (std::uint32_t k = node.offset; k < node.offset + node.count; ++k) {
+                        __m128 t, u, v;
+                        const __m128 hit = _mm_and_ps(inside, test_triangle4(test, packet, &corners_[3 * k], best_t, t, u, v));
+                        if (_mm_movemask_ps(hit) == 0) {
+                            continue;
+                        }
+                        // 与单条射线相同的取舍规则：参数更小，或参数相同而三角形下标更小（无符号比较）
+                        const __m128i id = _mm_set1_epi32(static_cast<int>(triangles_[k]));
+                        const __m128 smaller_id = _mm_castsi128_ps(
+                            _mm_cmplt_epi32(_mm_xor_si128(id, bias), _mm_xor_si128(best_id, bias)));
+                        const __m128 better = _mm_and_ps(
+                            hit, _mm_or_ps(_mm_cmplt_ps(t, best_t), _mm_and_ps(_mm_cmpeq_ps(t, best_t), smaller_id)));
+                        best_t = select(better, t, best_t);
+                        best_u = select(better, u, best_u);
+                        best_v = select(better, v, best_v);
+                        best_id = select(_mm_castps_si128(better), id, best_id);
+                    }
+                    continue;
+                }
+                if (packet.negative[node.axis]) {
+                    stack[top++] = self + 1;
+                    stack[top++] = node.offset;
+                } else {
+                    stack[top++] = node.offset;
+                    stack[top++] = self + 1;
+                }
+            }
+
+            alignas(16) float ts[4], us[4], vs[4];
+            alignas(16) std::uint32_t ids[4];
+            _mm_store_ps(ts, best_t);
+            _mm_store_ps(us, best_u);
+            _mm_store_ps(vs, best_v);
+            _mm_store_si128(reinterpret_cast<__m128i*>(ids), best_id);
+            for (std::size_t l = 0; l < lanes; ++l) {
+                if (ids[l] != kNoTriangle) {
+                    out[r + l] = TriangleHit{ts[l], us[l], vs[l], ids[l]};
+                    ++hits;
+                }
+            }
+        }
+#else
+        for (std::size_t r = begin; r < end; ++r) {
+            out[r] = TriangleHit{};
+            if (traverse(nodes_, corners_, triangles_, origins[r], directions[r], t_min, t_max, test, false, out[r])) {
+                ++hits;
+            }
+        }
+#endif
+        total += hits;
+    }, kRayChunk);
+    return total;
+}
+
+std::size_t TriangleBvh::occluded(const Point* origins, const Point* directions, std::size_t count, bool* out,
+                                  float t_min, float t_max, TriangleTest test) const {
+    std::atomic<std::size_t> total{0};
+    geometry::utils::parallel_for(count, [&](std::size_t begin, std::size_t end) {
+        std::size_t blocked = 0;
+#if defined(__SSE2__)
+        for (std::size_t r = begin; r < end; r += 4) {
+            const std::size_t lanes = std::min<std::size_t>(4, end - r);
+            int pending = (1 << lanes) - 1;
+            if (!nodes_.empty()) {
+                const Packet packet(origins + r, directions + r, lanes, t_min, t_max, test);
+                // 已被遮挡的通道把 t_max 设为 -inf，不再参与后续的求交
+                __m128 limit = packet.t_max;
+                std::uint32_t stack[kStackSize];
+                std::size_t top = 0;
+                stack[top++] = 0;
+                while (top > 0 && pending != 0) {
+                    const std::uint32_t self = stack[--top];
+                    const Node& node = nodes_[self];
+                    const int active = box_hit4(node.bounds, packet, limit);
+                    if (active == 0) {
+                        continue;
+                    }
+                    if (node.count > 0) {
+                        for (std::uint32_t k = node.offset; k < node.offset + node.count && pending != 0; ++k) {
+                            __m128 t, u, v;
+                            const int hit = _mm_movemask_ps(test_triangle4(test, packet, &corners_[3 * k], limit, t, u, v))
+                                            & active & pending;
+                            if (hit != 0) {
+                                pending &= ~hit;
+                                limit = select(lane_mask(hit), _mm_set1_ps(-std::numeric_limits<float>::infinity()), limit);
+                            }
+                        }
+                        continue;
+                    }
+                    if (packet.negative[node.axis]) {
+                        stack[top++] = self + 1;
+                        stack[top++] = node.offset;
+                    } else {
+                        stack[top++] = node.offset;
+                        stack[top++] = self + 1;
+                    }
+                }
+            }
+            for (std::size_t l = 0; l < lanes; ++l) {
+                out[r + l] = !((pending >> l) & 1);
+                blocked += out[r + l];
+            }
+        }
+#else
+        for (std::size_t r = begin; r < end; ++r) {
+            out[r] = occluded(origins[r], directions[r], t_min, t_max, test);
+            blocked += out[r];
+        }
+#endif
+        total += blocked;
+    }, kRayChunk);
+    return total;
+}
@@ -0,0 +1,48 @@
+#include "geometry/Triangulation.h"
+#include <stdexcept>
+
+std::size_t Triangulation::triangle_count() const noexcept {
+    return triangles.size() / 3;
+}
+
+std::size_t Triangulation::next_halfedge(std::size_t edge) noexcept {
+    return edge % 3 == 2 ? edge - 2 : edge + 1;
+}
+
+std::size_t Triangulation::prev_halfedge(std::size_t edge) noexcept {
+    return edge % 3 == 0 ? edge + 2 : edge - 1;
+}
+
+Polygon Triangulation::triangle(std::size_t index) const {
+    if (index >= triangle_count()) {
+        throw std::out_of_range("Triangle index out of range");
+    }
+    return Polygon({points[triangles[3 * index]], points[triangles[3 * index + 1]],
+                    points[triangles[3 * index + 2]]});
+}
+
+std::vector<std::uint32_t> Triangulation::hull() const {
+    std::vector<std::uint32_t> result;
+    std::size_t start = halfedges.size();
+    for (std::size_t e = 0; e < halfedges.size(); ++e) {
+        if (halfedges[e] == -1) {
+            start = e;
+            break;
+        }
+    }
+    if (start == halfedges.size()) {
+        return result;
+    }
+
+    // 沿凸包前进：从当前凸包边的终点出发，绕该顶点旋转找到下一条凸包边
+    std::size_t e = start;
+    do {
+        result.push_back(triangles[e]);
+        std::size_t next = next_halfedge(e);
+        while (halfedges[next] != -1) {
+            next = next_halfedge(static_cast<std::size_t>(halfedges[next]));
+        }
+        e = next;
+    } while (e != start && result.size() <= halfedges.size());
+    return result;
+}
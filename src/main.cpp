@@ -1,11 +1,35 @@
 #include <iostream>
 #include <vector>
 #include <iomanip>
+#include <algorithm>
 #include "geometry/Point.h"
 #include "geometry/Line.h"
 #include "geometry/Plane.h"
 #include "geometry/Polygon.h"
+#include "geometry/PolygonWithHoles.h"
+#include "geometry/ConvexShape.h"
+#include "geometry/ConvexVolume.h"
+#include "geometry/BspTree.h"
+#include "geometry/ConvexPolyhedron.h"
+#include "geometry/TriangleBvh.h"
+#include "geometry/SpatialHash.h"
+#include "geometry/Triangulation.h"
 #include "utils/utils.h"
+#include "utils/predicates.h"
+#include "utils/collision.h"
+#include "utils/minkowski.h"
+#include "utils/offset.h"
+#include "utils/calipers.h"
+#include "utils/enclosing.h"
+#include "utils/proximity.h"
+#include "utils/spacefill.h"
+#include "utils/delaunay.h"
+#include "utils/voronoi.h"
+#include "utils/slicing.h"
+#include "utils/halfspace.h"
+#include "utils/ransac.h"
+#include "utils/raycast.h"
+#include "utils/ccd.h"
 
 // 辅助函数：打印分隔线
 void print_separator(const std::string& title = "") {
@@ -133,6 +157,30 @@ void demo_planes() {
     std::cout << "plane1和plane2的夹角 = " << plane1.angle_with(plane2) << " 弧度" << std::endl;
     std::cout << "plane1和plane2的夹角 = " << geometry::utils::radians_to_degrees(plane1.angle_with(plane2)) << " 度" << std::endl;
     std::cout << "plane1和plane2是否平行: " << (plane1.is_parallel_to(plane2) ? "是" : "否") << std::endl;
+    
+    // 批量分类与原地划分
+    std::vector<Point> cloud = {
+        Point(0.0f, 0.0f, 6.0f), Point(1.0f, 2.0f, 5.0f), Point(2.0f, 1.0f, 3.0f),
+        Point(3.0f, 3.0f, 7.5f), Point(4.0f, 0.0f, 5.0f), Point(5.0f, 5.0f, 1.0f)
+    };
+    std::vector<std::int8_t> sides(cloud.size());
+    plane2.classify(cloud.data(), cloud.size(), sides.data());
+    std::cout << "点云相对plane2的分类:";
+    for (std::int8_t side : sides) {
+        std::cout << " " << static_cast<int>(side);
+    }
+    std::cout << std::endl;
+    PlanePartition parts = plane2.partition(cloud.data(), cloud.size());
+    std::cout << "划分结果: 正侧 " << parts.front << " 个, 平面上 " << parts.on << " 个, 负侧 " << parts.back << " 个" << std::endl;
+    
+    // 用平面切分竖直的正方形
+    Polygon wall({Point(0.0f, 0.0f, 4.0f), Point(2.0f, 0.0f, 4.0f), Point(2.0f, 0.0f, 6.0f), Point(0.0f, 0.0f, 6.0f)});
+    PolygonSplit pieces = plane2.split(wall);
+    std::cout << "切分竖直正方形: 正侧 " << pieces.front.vertices.size() << " 个顶点, 负侧 "
+              << pieces.back.vertices.size() << " 个顶点, 共面: " << (pieces.coplanar ? "是" : "否") << std::endl;
+    PolygonSplit flat = plane2.split(Polygon({Point(0.0f, 0.0f, 5.0f), Point(1.0f, 0.0f, 5.0f), Point(0.0f, 1.0f, 5.0f)}));
+    std::cout << "平面内的三角形: 共面: " << (flat.coplanar ? "是" : "否") << ", 归入"
+              << (flat.front.vertices.empty() ? "负侧" : "正侧") << std::endl;
 }
 
 // 演示多边形操作
@@ -242,6 +290,601 @@ void demo_utils() {
     } else {
         std::cout << "三个平面不存在唯一交点" << std::endl;
     }
+    
+    // 批量三平面交点：单位立方体六个面中相邻三个面交于顶点，相对的面平行
+    std::vector<Plane> faces = {
+        Plane(Point(1.0f, 0.0f, 0.0f), Point(0.0f, 0.0f, 0.0f)), Plane(Point(-1.0f, 0.0f, 0.0f), Point(1.0f, 0.0f, 0.0f)),
+        Plane(Point(0.0f, 1.0f, 0.0f), Point(0.0f, 0.0f, 0.0f)), Plane(Point(0.0f, -1.0f, 0.0f), Point(0.0f, 1.0f, 0.0f)),
+        Plane(Point(0.0f, 0.0f, 1.0f), Point(0.0f, 0.0f, 0.0f)), Plane(Point(0.0f, 0.0f, -1.0f), Point(0.0f, 0.0f, 1.0f))
+    };
+    geometry::utils::PlaneCoefficients coefficients(faces);
+    std::vector<std::uint32_t> triples = {1, 3, 5, 0, 2, 4, 0, 1, 2};
+    std::vector<Point> corners(3);
+    bool found[3];
+    const std::size_t solved = geometry::utils::intersections(coefficients, triples.data(), 3, corners.data(), found);
+    std::cout << "批量三平面交点: 有效 " << solved << " 组, 第一组 = " << corners[0]
+              << ", 第三组有唯一交点: " << (found[2] ? "是" : "否") << std::endl;
+}
+
+// 演示GJK/EPA碰撞查询
+void demo_collision() {
+    print_separator("GJK/EPA碰撞查询演示");
+    
+    Polygon square({Point(0.0f, 0.0f, 0.0f), Point(2.0f, 0.0f, 0.0f),
+                    Point(2.0f, 2.0f, 0.0f), Point(0.0f, 2.0f, 0.0f)});
+    ConvexShape a(square.convex_hull());
+    ConvexShape b(square.convex_hull());
+    b.position = Point(3.0f, 0.5f, 0.0f);
+    
+    // 逐帧移动形状 b，并用上一帧的单纯形热启动
+    geometry::utils::GjkCache cache;
+    for (int frame = 0; frame < 3; ++frame) {
+        auto result = geometry::utils::gjk_distance(a, b, &cache);
+        std::cout << "帧" << frame << ": b的位置 = " << b.position
+                  << ", 距离 = " << result.distance
+                  << ", 迭代次数 = " << result.iterations << std::endl;
+        b.position.x -= 0.8f;
+    }
+    
+    auto penetration = geometry::utils::epa_penetration(a, b, &cache);
+    if (penetration) {
+        std::cout << "穿透方向 = " << penetration->normal
+                  << ", 穿透深度 = " << penetration->depth << std::endl;
+    }
+}
+
+// 演示Minkowski和
+void demo_minkowski() {
+    print_separator("Minkowski和演示");
+    
+    // 机器人占地（凸）与L形障碍物（非凸）
+    Polygon footprint({Point(-0.5f, -0.5f, 0.0f), Point(0.5f, -0.5f, 0.0f),
+                       Point(0.5f, 0.5f, 0.0f), Point(-0.5f, 0.5f, 0.0f)});
+    Polygon obstacle({Point(0.0f, 0.0f, 0.0f), Point(3.0f, 0.0f, 0.0f), Point(3.0f, 1.0f, 0.0f),
+                      Point(1.0f, 1.0f, 0.0f), Point(1.0f, 3.0f, 0.0f), Point(0.0f, 3.0f, 0.0f)});
+    
+    std::cout << "凸多边形之和 = " << geometry::utils::minkowski_sum_convex(footprint, footprint) << std::endl;
+    
+    std::vector<Polygon> parts = geometry::utils::convex_decomposition(obstacle);
+    std::cout << "L形障碍物的凸分解块数 = " << parts.size() << std::endl;
+    
+    // 结果写入可复用的缓冲区
+    PolygonBuffer buffer;
+    geometry::utils::minkowski_sum(obstacle, footprint, buffer);
+    for (std::size_t i = 0; i < buffer.size(); ++i) {
+        std::cout << "膨胀后的凸块" << i << " = " << buffer.polygon(i) << std::endl;
+    }
+}
+
+// 演示多边形偏移
+void demo_offset() {
+    print_separator("多边形偏移演示");
+    
+    Polygon square({Point(0.0f, 0.0f, 0.0f), Point(2.0f, 0.0f, 0.0f),
+                    Point(2.0f, 2.0f, 0.0f), Point(0.0f, 2.0f, 0.0f)});
+    
+    auto miter = geometry::utils::offset_polygon(square, 0.5f, geometry::utils::JoinType::Miter);
+    auto round = geometry::utils::offset_polygon(square, 0.5f, geometry::utils::JoinType::Round);
+    auto shrunk = geometry::utils::offset_polygon(square, -0.5f);
+    std::cout << "尖角扩张0.5后的面积 = " << miter[0].area() << std::endl;
+    std::cout << "圆角扩张0.5后的面积 = " << round[0].area() << std::endl;
+    std::cout << "收缩0.5后的多边形 = " << shrunk[0] << std::endl;
+    
+    // 收缩过度时多边形消失
+    std::cout << "收缩1.5后的多边形个数 = " << geometry::utils::offset_polygon(square, -1.5f).size() << std::endl;
+}
+
+// 演示旋转卡壳
+void demo_calipers() {
+    print_separator("旋转卡壳演示");
+    
+    std::vector<Point> points = {
+        Point(0.0f, 0.0f, 0.0f), Point(4.0f, 1.0f, 0.0f), Point(5.0f, 3.0f, 0.0f),
+        Point(1.0f, 2.0f, 0.0f), Point(2.0f, 1.0f, 0.0f), Point(3.0f, 3.5f, 0.0f)
+    };
+    Polygon hull = Polygon(points).convex_hull();
+    std::cout << "凸包 = " << hull << std::endl;
+    
+    auto [a, b] = geometry::utils::farthest_pair(hull);
+    std::cout << "最远点对 = " << a << ", " << b << std::endl;
+    std::cout << "直径 = " << geometry::utils::diameter(hull) << std::endl;
+    std::cout << "最小宽度 = " << geometry::utils::minimum_width(hull) << std::endl;
+    
+    Polygon rect = geometry::utils::min_area_rectangle(hull);
+    std::cout << "最小面积外接矩形 = " << rect << ", 面积 = " << rect.area() << std::endl;
+    Polygon rect2 = geometry::utils::min_perimeter_rectangle(hull);
+    std::cout << "最小周长外接矩形的周长 = " << rect2.perimeter() << std::endl;
+}
+
+void demo_enclosing() {
+    print_separator("最小外接圆/球演示");
+    
+    std::vector<Point> points = {
+        Point(0.0f, 0.0f, 0.0f), Point(4.0f, 0.0f, 1.0f), Point(2.0f, 3.0f, -1.0f),
+        Point(1.0f, 1.0f, 2.0f), Point(3.0f, 1.0f, 0.0f)
+    };
+    
+    Circle circle = geometry::utils::min_enclosing_circle(points);
+    std::cout << "最小外接圆 = " << circle << std::endl;
+    Sphere sphere = geometry::utils::min_enclosing_sphere(points);
+    std::cout << "最小外接球 = " << sphere << std::endl;
+    Sphere rough = geometry::utils::ritter_sphere(points);
+    std::cout << "Ritter 近似球 = " << rough << std::endl;
+}
+
+void demo_proximity() {
+    print_separator("最近点对与最近邻演示");
+    
+    std::vector<Point> points = {
+        Point(0.0f, 0.0f, 0.0f), Point(3.0f, 1.0f, 0.0f), Point(3.2f, 1.1f, 0.1f),
+        Point(-2.0f, 4.0f, 1.0f), Point(5.0f, -1.0f, 2.0f)
+    };
+    
+    auto pair = geometry::utils::closest_pair(points);
+    std::cout << "最近点对 = " << points[pair.first] << ", " << points[pair.second]
+              << ", 距离 = " << pair.distance << std::endl;
+    
+    auto neighbors = geometry::utils::all_nearest_neighbors(points);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        std::cout << "点 " << i << " 的最近邻 = " << neighbors[i].index
+                  << ", 距离 = " << neighbors[i].distance << std::endl;
+    }
+    
+    // 聚集分布：三个很小的点簇加上远处的离群点，整体包围盒中绝大部分空间是空的
+    std::vector<Point> clustered;
+    for (int c = 0; c < 3; ++c) {
+        for (int i = 0; i < 1000; ++i) {
+            const float angle = 0.001f * static_cast<float>(i * i);
+            clustered.push_back(Point(static_cast<float>(c) + 0.01f * std::cos(angle),
+                                      0.01f * std::sin(angle), 0.0001f * static_cast<float>(i)));
+        }
+    }
+    clustered.push_back(Point(1e5f, 0.0f, 0.0f));
+    clustered.push_back(Point(-1e5f, 1e5f, 0.0f));
+    const auto clustered_neighbors = geometry::utils::all_nearest_neighbors(clustered);
+    float largest = 0.0f;
+    for (std::size_t i = 0; i + 2 < clustered.size(); ++i) {
+        largest = std::max(largest, clustered_neighbors[i].distance);
+    }
+    std::cout << "聚集点集 (" << clustered.size() << " 个点): 簇内最大最近邻距离 = " << std::setprecision(4)
+              << largest << ", 离群点的最近邻距离 = " << clustered_neighbors.back().distance
+              << std::setprecision(2) << std::endl;
+}
+
+void demo_spatial_hash() {
+    print_separator("空间哈希演示");
+    
+    std::vector<Point> agents = {
+        Point(0.0f, 0.0f, 0.0f), Point(1.0f, 0.5f, 0.0f), Point(4.0f, 4.0f, 0.0f),
+        Point(-1.5f, 0.2f, 0.0f), Point(10.0f, 0.0f, 0.0f)
+    };
+    
+    SpatialHash grid(2.0f);
+    grid.rebuild(agents);
+    std::cout << "重建后的点数 = " << grid.size() << std::endl;
+    
+    auto report = [&]() {
+        auto ids = grid.query_radius(Point(0.0f, 0.0f, 0.0f), 2.0f);
+        std::sort(ids.begin(), ids.end());
+        std::cout << "原点附近半径2内的点:";
+        for (auto id : ids) {
+            std::cout << " " << id;
+        }
+        std::cout << std::endl;
+    };
+    report();
+    
+    grid.move(2, Point(0.5f, -0.5f, 0.0f));
+    grid.remove(3);
+    SpatialHash::Id id = grid.insert(Point(-0.5f, -0.5f, 0.0f));
+    std::cout << "移动点2、删除点3并插入新点 " << id << " 后, ";
+    report();
+}
+
+void demo_spacefill() {
+    print_separator("空间填充曲线排序演示");
+    
+    std::cout << "Morton(3, 5) = " << geometry::utils::morton_encode_2d(3, 5)
+              << ", Hilbert(3, 5) = " << geometry::utils::hilbert_encode_2d(3, 5) << std::endl;
+    
+    std::vector<Point> points = {
+        Point(3.0f, 3.0f, 0.0f), Point(0.0f, 0.0f, 0.0f), Point(3.0f, 0.0f, 0.0f),
+        Point(0.0f, 3.0f, 0.0f), Point(1.0f, 1.0f, 0.0f), Point(2.0f, 2.0f, 0.0f)
+    };
+    geometry::utils::sort_by_curve(points, geometry::utils::CurveType::Hilbert, 2);
+    std::cout << "按 Hilbert 顺序排列的点:" << std::endl;
+    for (const auto& p : points) {
+        std::cout << "  " << p << std::endl;
+    }
+}
+
+void demo_delaunay() {
+    print_separator("Delaunay 三角剖分演示");
+    
+    std::vector<Point> points = {
+        Point(0.0f, 0.0f, 0.0f), Point(4.0f, 0.0f, 0.0f), Point(4.0f, 3.0f, 0.0f),
+        Point(0.0f, 3.0f, 0.0f), Point(2.0f, 1.5f, 0.0f), Point(1.0f, 2.5f, 0.0f)
+    };
+    
+    Triangulation tin = geometry::utils::delaunay(points);
+    std::cout << "三角形数量 = " << tin.triangle_count() << std::endl;
+    for (std::size_t i = 0; i < tin.triangle_count(); ++i) {
+        std::cout << "  三角形 " << i << ": " << tin.triangles[3 * i] << ", "
+                  << tin.triangles[3 * i + 1] << ", " << tin.triangles[3 * i + 2] << std::endl;
+    }
+    std::cout << "凸包顶点数 = " << tin.hull().size() << std::endl;
+}
+
+void demo_voronoi() {
+    print_separator("Voronoi 单元演示");
+    
+    std::vector<Point> depots = {
+        Point(1.0f, 1.0f, 0.0f), Point(5.0f, 1.0f, 0.0f), Point(3.0f, 4.0f, 0.0f), Point(3.0f, 2.0f, 0.0f)
+    };
+    Polygon bounds({Point(0.0f, 0.0f, 0.0f), Point(6.0f, 0.0f, 0.0f), Point(6.0f, 5.0f, 0.0f), Point(0.0f, 5.0f, 0.0f)});
+    
+    Triangulation tin = geometry::utils::delaunay(depots);
+    auto cells = geometry::utils::voronoi_cells(tin, bounds);
+    for (std::size_t i = 0; i < cells.size(); ++i) {
+        std::cout << "站点 " << i << " 的服务区域面积 = " << cells[i].area() << std::endl;
+    }
+    
+    auto subset = geometry::utils::voronoi_cells(tin, std::vector<std::uint32_t>{3}, bounds);
+    std::cout << "只计算站点3: " << subset[0] << std::endl;
+}
+
+void demo_constrained_delaunay() {
+    print_separator("约束 Delaunay 三角剖分演示");
+    
+    PolygonWithHoles plate(Polygon({Point(0.0f, 0.0f, 0.0f), Point(10.0f, 0.0f, 0.0f), Point(10.0f, 6.0f, 0.0f), Point(0.0f, 6.0f, 0.0f)}));
+    plate.add_hole(Polygon({Point(3.0f, 2.0f, 0.0f), Point(3.0f, 4.0f, 0.0f), Point(7.0f, 4.0f, 0.0f), Point(7.0f, 2.0f, 0.0f)}));
+    std::cout << "带洞平板面积 = " << plate.area() << std::endl;
+    
+    Triangulation mesh = geometry::utils::constrained_delaunay(plate);
+    std::cout << "约束三角剖分: 三角形数 = " << mesh.triangle_count() << std::endl;
+    
+    Triangulation refined = geometry::utils::constrained_delaunay(plate, 25.0f);
+    std::cout << "最小角25度加密后: 顶点数 = " << refined.points.size()
+              << ", 三角形数 = " << refined.triangle_count() << std::endl;
+}
+
+void demo_predicates() {
+    print_separator("鲁棒谓词演示");
+    
+    // 三个几乎共线的点：float 叉积加容差会误判为共线
+    Point a(0.5f, 0.5f, 0.0f);
+    Point b(12.0f, 12.0f, 0.0f);
+    Point c(24.0f, 24.000002f, 0.0f);
+    const double side = geometry::utils::orient2d(a, b, c);
+    std::cout << "orient2d(a, b, c): " << (side > 0.0 ? "逆时针" : side < 0.0 ? "顺时针" : "共线") << std::endl;
+    std::cout << "incircle(单位正方形四角) = "
+              << geometry::utils::incircle(Point(0.0f, 0.0f, 0.0f), Point(1.0f, 0.0f, 0.0f),
+                                           Point(1.0f, 1.0f, 0.0f), Point(0.0f, 1.0f, 0.0f)) << std::endl;
+    
+    Line diagonal(a, c);
+    Line probe(b, Point(12.0f, 0.0f, 0.0f));
+    std::cout << "精确谓词: 线段相交 = " << (diagonal.intersects(probe) ? "是" : "否") << std::endl;
+    geometry::utils::set_predicate_policy(geometry::utils::PredicatePolicy::Epsilon);
+    std::cout << "容差判断: 线段相交 = " << (diagonal.intersects(probe) ? "是" : "否") << std::endl;
+    geometry::utils::set_predicate_policy(geometry::utils::PredicatePolicy::Exact);
+    
+    // 统计规则网格（大量共圆点）上各求值阶段的命中次数
+    std::vector<Point> grid;
+    for (int i = 0; i < 20; ++i) {
+        for (int j = 0; j < 20; ++j) {
+            grid.emplace_back(static_cast<float>(i), static_cast<float>(j), 0.0f);
+        }
+    }
+    geometry::utils::reset_predicate_stats();
+    geometry::utils::set_predicate_stats_enabled(true);
+    (void)geometry::utils::delaunay(grid);
+    geometry::utils::set_predicate_stats_enabled(false);
+    const auto stats = geometry::utils::predicate_stats().incircle;
+    std::cout << "网格三角剖分 incircle: 调用 " << stats.calls() << " 次, 过滤命中 " << stats.filter_hits
+              << ", 区间命中 " << stats.interval_hits << ", 精确求值 " << stats.exact_evaluations
+              << " (升级比例 " << stats.escalation_rate() * 100.0 << "%)" << std::endl;
+}
+
+void demo_frustum_culling() {
+    print_separator("视锥体剔除演示");
+    
+    // 相机在原点沿 -z 方向观察
+    ConvexVolume frustum = ConvexVolume::frustum(Point(0.0f, 0.0f, 0.0f), Point(0.0f, 0.0f, -1.0f),
+                                                 Point(0.0f, 1.0f, 0.0f), 1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+    std::cout << "视锥体平面数 = " << frustum.plane_count() << std::endl;
+    
+    const auto name = [](Containment c) {
+        return c == Containment::Inside ? "内部" : c == Containment::Outside ? "外部" : "相交";
+    };
+    std::cout << "点(0, 0, -10): " << name(frustum.classify(Point(0.0f, 0.0f, -10.0f))) << std::endl;
+    std::cout << "点(0, 0, 10): " << name(frustum.classify(Point(0.0f, 0.0f, 10.0f))) << std::endl;
+    std::cout << "跨越近平面的包围盒: "
+              << name(frustum.classify(BoundingBox(Point(-1.0f, -1.0f, -1.0f), Point(1.0f, 1.0f, 1.0f)))) << std::endl;
+    std::cout << "远处的球: " << name(frustum.classify(Sphere(Point(0.0f, 0.0f, -50.0f), 2.0f))) << std::endl;
+    std::cout << "横穿视野的线段: "
+              << name(frustum.classify(Line(Point(-100.0f, 0.0f, -20.0f), Point(100.0f, 0.0f, -20.0f)))) << std::endl;
+    
+    // 批量剔除一排包围盒，hint 在帧间保留
+    std::vector<BoundingBox> boxes;
+    for (int i = 0; i < 8; ++i) {
+        const float x = -80.0f + 20.0f * static_cast<float>(i);
+        boxes.emplace_back(Point(x - 1.0f, -1.0f, -31.0f), Point(x + 1.0f, 1.0f, -29.0f));
+    }
+    std::vector<Containment> results(boxes.size());
+    std::vector<std::uint32_t> hints(boxes.size(), ConvexVolume::kNoHint);
+    for (int frame = 0; frame < 2; ++frame) {
+        frustum.classify(boxes.data(), boxes.size(), results.data(), hints.data());
+    }
+    std::cout << "一排包围盒:";
+    for (Containment c : results) {
+        std::cout << " " << name(c);
+    }
+    std::cout << std::endl;
+}
+
+void demo_slicing() {
+    print_separator("网格切片演示");
+    
+    // 单位立方体（外法向量，逆时针），顶面恰好落在最后一个切片平面上
+    std::vector<Point> vertices = {
+        Point(0.0f, 0.0f, 0.0f), Point(1.0f, 0.0f, 0.0f), Point(1.0f, 1.0f, 0.0f), Point(0.0f, 1.0f, 0.0f),
+        Point(0.0f, 0.0f, 1.0f), Point(1.0f, 0.0f, 1.0f), Point(1.0f, 1.0f, 1.0f), Point(0.0f, 1.0f, 1.0f)
+    };
+    std::vector<std::uint32_t> triangles = {
+        0, 2, 1, 0, 3, 2,  4, 5, 6, 4, 6, 7,  0, 1, 5, 0, 5, 4,
+        1, 2, 6, 1, 6, 5,  2, 3, 7, 2, 7, 6,  3, 0, 4, 3, 4, 7
+    };
+    std::vector<Plane> planes;
+    for (int i = 1; i <= 4; ++i) {
+        planes.emplace_back(Point(0.0f, 0.0f, 1.0f), Point(0.0f, 0.0f, 0.25f * static_cast<float>(i)));
+    }
+    
+    const auto layers = geometry::utils::slice_mesh(vertices, triangles, planes);
+    for (std::size_t i = 0; i < layers.size(); ++i) {
+        std::cout << "z = " << planes[i].point.z << ": 轮廓数 = " << layers[i].contours.size();
+        for (const Polygon& contour : layers[i].contours) {
+            std::cout << ", 面积 = " << contour.signed_area();
+        }
+        std::cout << std::endl;
+    }
+}
+
+void demo_bsp() {
+    print_separator("BSP树演示");
+    
+    // 一个房间的地面和两面相交的墙
+    std::vector<Polygon> scene = {
+        Polygon({Point(0.0f, 0.0f, 0.0f), Point(4.0f, 0.0f, 0.0f), Point(4.0f, 4.0f, 0.0f), Point(0.0f, 4.0f, 0.0f)}),
+        Polygon({Point(2.0f, 0.0f, 0.0f), Point(2.0f, 4.0f, 0.0f), Point(2.0f, 4.0f, 3.0f), Point(2.0f, 0.0f, 3.0f)}),
+        Polygon({Point(0.0f, 2.0f, 0.0f), Point(0.0f, 2.0f, 3.0f), Point(4.0f, 2.0f, 3.0f), Point(4.0f, 2.0f, 0.0f)})
+    };
+    BspTree tree(scene);
+    std::cout << "节点数 = " << tree.nodes().size() << ", 片段数 = " << tree.fragments().size()
+              << ", 切分次数 = " << tree.split_count() << ", 深度 = " << tree.depth() << std::endl;
+    
+    std::vector<std::uint32_t> order;
+    tree.front_to_back(Point(3.0f, 3.0f, 1.0f), order);
+    std::cout << "从(3, 3, 1)看由近到远的片段来源:";
+    for (std::uint32_t fragment : order) {
+        std::cout << " " << tree.sources()[fragment];
+    }
+    std::cout << std::endl;
+}
+
+void demo_halfspace() {
+    print_separator("半空间交集演示");
+    
+    // [-1, 1]^3 立方体的6个面（法向量指向内部），再加一个切掉一角的平面和一个冗余平面
+    std::vector<Plane> planes = {
+        Plane(1.0f, 0.0f, 0.0f, 1.0f), Plane(-1.0f, 0.0f, 0.0f, 1.0f),
+        Plane(0.0f, 1.0f, 0.0f, 1.0f), Plane(0.0f, -1.0f, 0.0f, 1.0f),
+        Plane(0.0f, 0.0f, 1.0f, 1.0f), Plane(0.0f, 0.0f, -1.0f, 1.0f),
+        Plane(-1.0f, -1.0f, -1.0f, 2.0f), Plane(1.0f, 1.0f, 1.0f, 10.0f)
+    };
+    if (auto sphere = geometry::utils::inscribed_sphere(planes)) {
+        std::cout << "最大内切球: 中心 " << sphere->center << ", 半径 = " << sphere->radius << std::endl;
+    }
+    if (auto polyhedron = geometry::utils::halfspace_intersection(planes)) {
+        std::cout << "凸多面体: 顶点数 = " << polyhedron->vertices.size() << ", 面数 = " << polyhedron->face_count()
+                  << ", 体积 = " << polyhedron->volume() << std::endl;
+        std::cout << "各面来源平面:";
+        for (std::uint32_t plane : polyhedron->face_planes) {
+            std::cout << " " << plane;
+        }
+        std::cout << std::endl;
+    }
+    
+    planes.pop_back();
+    planes.erase(planes.begin());
+    std::cout << "去掉 x >= -1 后交集无界: "
+              << (geometry::utils::halfspace_intersection(planes) ? "否" : "是") << std::endl;
+}
+
+void demo_plane_detection() {
+    print_separator("平面拟合与RANSAC检测演示");
+    
+    // 地面 z = 0 与墙面 x = 2 上的规则采样点，带少量确定性的扰动，再加一些杂点
+    std::vector<Point> ground, scan;
+    for (int i = 0; i < 40; ++i) {
+        for (int j = 0; j < 40; ++j) {
+            const float jitter = 0.002f * static_cast<float>((i * 7 + j * 13) % 5 - 2);
+            ground.emplace_back(i * 0.05f, j * 0.05f, jitter);
+            scan.emplace_back(2.0f + jitter, j * 0.05f, 0.1f + i * 0.05f);
+        }
+    }
+    for (int i = 0; i < 200; ++i) {
+        scan.emplace_back(0.3f + 0.007f * i, 0.5f + 0.011f * (i % 97), 0.2f + 0.013f * (i % 61));
+    }
+    scan.insert(scan.end(), ground.begin(), ground.end());
+    
+    if (auto plane = Plane::fit(ground.data(), ground.size())) {
+        std::cout << "地面点的最小二乘平面: " << *plane << std::endl;
+    }
+    
+    geometry::utils::PlaneDetectionOptions options;
+    options.threshold = 0.01f;
+    options.min_inliers = 500;
+    const auto planes = geometry::utils::detect_planes(scan, options);
+    std::cout << "检测到 " << planes.size() << " 个平面:" << std::endl;
+    for (const auto& detected : planes) {
+        std::cout << "  " << detected.plane << ", 内点数 = " << detected.inliers.size() << std::endl;
+    }
+}
+
+void demo_ray_casting() {
+    print_separator("批量射线-平面求交演示");
+    
+    // 一个走廊：地面、天花板和两面侧墙
+    geometry::utils::PlaneCoefficients planes(std::vector<Plane>{
+        Plane(0.0f, 0.0f, 1.0f, 0.0f), Plane(0.0f, 0.0f, -1.0f, 3.0f),
+        Plane(1.0f, 0.0f, 0.0f, 2.0f), Plane(-1.0f, 0.0f, 0.0f, 2.0f)
+    });
+    
+    // 从走廊中央向不同方向发出单位长度方向的射线，t 即为距离
+    geometry::utils::RayBatch rays;
+    const Point eye(0.0f, 0.0f, 1.5f);
+    for (int i = 0; i < 6; ++i) {
+        const float angle = static_cast<float>(i) * 0.6f;
+        rays.push_back(eye, Point(std::cos(angle), 0.0f, std::sin(angle)));
+    }
+    rays.push_back(eye, Point(0.0f, 1.0f, 0.0f));
+    
+    std::vector<float> distance(rays.size());
+    std::vector<std::uint32_t> plane(rays.size());
+    const std::size_t hits = geometry::utils::closest_ray_plane_hits(rays, planes, distance.data(), plane.data());
+    std::cout << "命中射线数 = " << hits << " / " << rays.size() << std::endl;
+    for (std::size_t r = 0; r < rays.size(); ++r) {
+        std::cout << "  射线 " << r << ": ";
+        if (plane[r] == geometry::utils::kNoHit) {
+            std::cout << "未命中" << std::endl;
+        } else {
+            std::cout << "平面 " << plane[r] << ", 距离 = " << distance[r] << std::endl;
+        }
+    }
+}
+
+void demo_triangle_bvh() {
+    print_separator("三角形 BVH 射线求交演示");
+    
+    // 起伏的地形网格：中间有一道山脊
+    const int n = 32;
+    std::vector<Point> vertices;
+    std::vector<std::uint32_t> triangles;
+    for (int j = 0; j <= n; ++j) {
+        for (int i = 0; i <= n; ++i) {
+            const float x = static_cast<float>(i), y = static_cast<float>(j);
+            vertices.emplace_back(x, y, 4.0f * std::exp(-(x - 16.0f) * (x - 16.0f) / 8.0f));
+        }
+    }
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            const auto a = static_cast<std::uint32_t>(j * (n + 1) + i);
+            const auto c = a + static_cast<std::uint32_t>(n + 1);
+            triangles.insert(triangles.end(), {a, a + 1, c + 1, a, c + 1, c});
+        }
+    }
+    TriangleBvh bvh(vertices, triangles);
+    std::cout << "三角形数 = " << bvh.triangle_count() << ", 节点数 = " << bvh.nodes().size()
+              << ", 深度 = " << bvh.depth() << std::endl;
+    
+    // 视线查询：direction = target - eye，t_max = 1，只关心之间有没有遮挡
+    const Point eye(4.0f, 16.0f, 3.0f);
+    std::vector<Point> origins, directions;
+    for (float x : {8.0f, 14.0f, 20.0f, 28.0f}) {
+        origins.push_back(eye);
+        directions.push_back(Point(x, 16.0f, 3.0f) - eye);
+    }
+    bool blocked[4];
+    const std::size_t count = bvh.occluded(origins.data(), directions.data(), origins.size(), blocked, 0.0f, 1.0f,
+                                           TriangleTest::Watertight);
+    std::cout << "被山脊遮挡的目标数 = " << count << " / " << origins.size() << std::endl;
+    for (std::size_t k = 0; k < origins.size(); ++k) {
+        std::cout << "  目标 " << origins[k] + directions[k] << ": " << (blocked[k] ? "不可见" : "可见") << std::endl;
+    }
+    
+    // 最近交点：从高处向斜下方观察
+    if (auto hit = bvh.intersect(Point(0.0f, 16.0f, 10.0f), Point(1.0f, 0.0f, -0.5f))) {
+        std::cout << "最近交点: 三角形 " << hit->triangle << ", t = " << hit->t << std::endl;
+    }
+}
+
+void demo_closest_points() {
+    print_separator("最近点查询演示");
+    
+    // 两条异面线段：无限长直线的距离比线段的实际距离小
+    const Line pipe(Point(0.0f, 0.0f, 0.0f), Point(4.0f, 0.0f, 0.0f));
+    const Line cable(Point(6.0f, -1.0f, 1.0f), Point(6.0f, 1.0f, 1.0f));
+    const auto segments = geometry::utils::segment_closest_points(pipe, cable);
+    std::cout << "直线距离 = " << geometry::utils::distance(pipe, cable)
+              << ", 线段距离 = " << segments.distance << std::endl;
+    std::cout << "最近点: " << segments.first << " (s = " << segments.s << "), "
+              << segments.second << " (t = " << segments.t << ")" << std::endl;
+    
+    // 路径采样点到障碍三角形的间隙
+    const Point a(0.0f, 0.0f, 0.0f), b(2.0f, 0.0f, 0.0f), c(0.0f, 2.0f, 0.0f);
+    std::vector<Point> samples, corners;
+    for (int i = 0; i < 4; ++i) {
+        samples.push_back(Point(-1.0f + static_cast<float>(i), 0.5f, 1.0f));
+        corners.insert(corners.end(), {a, b, c});
+    }
+    std::vector<geometry::utils::TriangleClosestPoint> clearance(samples.size());
+    geometry::utils::triangle_closest_points(samples.data(), corners.data(), samples.size(), clearance.data());
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        std::cout << "  采样点 " << samples[i] << ": 最近点 " << clearance[i].point
+                  << ", 间隙 = " << clearance[i].distance << std::endl;
+    }
+}
+
+void demo_continuous_collision() {
+    print_separator("连续碰撞检测演示");
+    
+    // 高速移动的点穿过一堵薄墙：按 t = 0, 0.25, 0.5, 0.75, 1 采样时点都不在墙内
+    const Polygon wall(std::vector<Point>{
+        Point(0.3f, -1.0f, 0.0f), Point(0.32f, -1.0f, 0.0f), Point(0.32f, 1.0f, 0.0f), Point(0.3f, 1.0f, 0.0f)
+    });
+    const Point from(-2.0f, 0.0f, 0.0f), to(2.0f, 0.0f, 0.0f);
+    bool sampled_hit = false;
+    for (int i = 0; i <= 4; ++i) {
+        sampled_hit = sampled_hit || wall.contains_point(from + (to - from) * (0.25 * i));
+    }
+    const auto impact = geometry::utils::time_of_impact(from, to, wall);
+    std::cout << "离散采样检测到碰撞: " << (sampled_hit ? "是" : "否") << ", 连续检测: ";
+    if (impact) {
+        std::cout << "t = " << impact->time << ", 接触点 " << impact->point_b << std::endl;
+    } else {
+        std::cout << "无碰撞" << std::endl;
+    }
+    
+    // 两条交叉的线段：一条静止在 z = 0，另一条从 z = 1 斜向下平移到 z = -1，解析接触时刻为 t = 0.5
+    const Line rail(Point(-1.0f, 0.0f, 0.0f), Point(1.0f, 0.0f, 0.0f));
+    const Line bar_from(Point(0.0f, -1.0f, 1.0f), Point(0.0f, 1.0f, 1.0f));
+    const Line bar_to(Point(0.3f, -0.8f, -1.0f), Point(0.3f, 1.2f, -1.0f));
+    const geometry::utils::ToiOptions options;
+    if (auto crossing = geometry::utils::time_of_impact(rail, rail, bar_from, bar_to, options)) {
+        // 距离为 |1 - 2t|，报告的时刻与解析解之差不超过 tolerance / 2
+        const bool exact = std::abs(crossing->time - 0.5f) <= 0.5f * options.tolerance;
+        std::cout << "交叉线段: t = " << std::setprecision(5) << crossing->time << std::setprecision(2)
+                  << " (解析解 0.5, 误差在容差内: " << (exact ? "是" : "否") << ", 迭代 "
+                  << crossing->iterations << " 次)" << std::endl;
+    }
+    
+    // 三根平移的连杆：先用扫掠包围盒粗筛，再求最早接触
+    const std::vector<Line> start{
+        Line(Point(0.0f, 0.0f, 0.0f), Point(1.0f, 0.0f, 0.0f)),
+        Line(Point(3.0f, -0.5f, 0.0f), Point(3.0f, 0.5f, 0.0f)),
+        Line(Point(10.0f, 0.0f, 0.0f), Point(11.0f, 0.0f, 0.0f))
+    };
+    const std::vector<Line> end{
+        Line(Point(4.0f, 0.0f, 0.0f), Point(5.0f, 0.0f, 0.0f)),
+        Line(Point(2.0f, -0.5f, 0.0f), Point(2.0f, 0.5f, 0.0f)),
+        Line(Point(10.0f, 1.0f, 0.0f), Point(11.0f, 1.0f, 0.0f))
+    };
+    const auto pairs = geometry::utils::swept_box_pairs(start, end, 1e-4f);
+    std::cout << "候选连杆对数 = " << pairs.size() << std::endl;
+    if (auto earliest = geometry::utils::earliest_impact(start, end, pairs)) {
+        std::cout << "最早接触: 连杆 " << earliest->first << " 与 " << earliest->second
+                  << ", t = " << earliest->impact.time << ", 位置 " << earliest->impact.point_a << std::endl;
+    }
 }
 
 int main() {
@@ -256,6 +899,27 @@ int main() {
     demo_planes();
     demo_polygons();
     demo_utils();
+    demo_collision();
+    demo_minkowski();
+    demo_offset();
+    demo_calipers();
+    demo_enclosing();
+    demo_proximity();
+    demo_spatial_hash();
+    demo_spacefill();
+    demo_delaunay();
+    demo_voronoi();
+    demo_constrained_delaunay();
+    demo_predicates();
+    demo_frustum_culling();
+    demo_slicing();
+    demo_bsp();
+    demo_halfspace();
+    demo_plane_detection();
+    demo_ray_casting();
+    demo_triangle_bvh();
+    demo_closest_points();
+    demo_continuous_collision();
     
     print_separator("演示结束");
     return 0;
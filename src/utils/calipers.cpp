@@ -0,0 +1,199 @@
+#include "utils/calipers.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+struct V2 {
+    double x = 0.0, y = 0.0;
+};
+
+inline V2 operator+(const V2& a, const V2& b) { return {a.x + b.x, a.y + b.y}; }
+inline V2 operator-(const V2& a, const V2& b) { return {a.x - b.x, a.y - b.y}; }
+inline V2 operator*(const V2& a, double s) { return {a.x * s, a.y * s}; }
+inline double dot(const V2& a, const V2& b) { return a.x * b.x + a.y * b.y; }
+inline double cross(const V2& a, const V2& b) { return a.x * b.y - a.y * b.x; }
+
+// 把凸包整理成逆时针、无重复相邻顶点的双精度数组
+std::vector<V2> ccw_hull(const Polygon& hull) {
+    std::vector<V2> pts;
+    pts.reserve(hull.vertices.size());
+    for (const auto& v : hull.vertices) {
+        const V2 p{v.x, v.y};
+        if (pts.empty() || pts.back().x != p.x || pts.back().y != p.y) {
+            pts.push_back(p);
+        }
+    }
+    while (pts.size() > 1 && pts.front().x == pts.back().x && pts.front().y == pts.back().y) {
+        pts.pop_back();
+    }
+    double area = 0.0;
+    for (std::size_t i = 0; i < pts.size(); ++i) {
+        area += cross(pts[i], pts[(i + 1) % pts.size()]);
+    }
+    if (area < 0.0) {
+        std::reverse(pts.begin(), pts.end());
+    }
+    return pts;
+}
+
+inline Point to_point(const V2& p, float z) {
+    return Point(static_cast<float>(p.x), static_cast<float>(p.y), z);
+}
+
+// 以每条边为底旋转卡壳，返回使 metric(宽, 高) 最小的外接矩形
+template <typename Metric>
+Polygon min_rectangle(const Polygon& hull, Metric metric) {
+    const std::vector<V2> h = ccw_hull(hull);
+    const std::size_t n = h.size();
+    const float z = hull.vertices.empty() ? 0.0f : hull.vertices.front().z;
+    if (n == 0) {
+        return Polygon();
+    }
+    if (n < 3) {
+        // 退化为点或线段
+        std::vector<Point> corners;
+        for (const auto& p : h) {
+            corners.push_back(to_point(p, z));
+        }
+        return Polygon(corners);
+    }
+
+    std::size_t r = 0, t = 0, l = 0;
+    double best = std::numeric_limits<double>::max();
+    V2 best_corners[4];
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const V2 e = h[(i + 1) % n] - h[i];
+        const double len = std::hypot(e.x, e.y);
+        if (len == 0.0) {
+            continue;
+        }
+        const V2 u = e * (1.0 / len);
+        const V2 v{-u.y, u.x};
+
+        if (i == 0) {
+            r = 0;
+        }
+        while (dot(h[(r + 1) % n] - h[r], u) > 0.0) {
+            r = (r + 1) % n;
+        }
+        if (i == 0) {
+            t = r;
+        }
+        while (dot(h[(t + 1) % n] - h[t], v) > 0.0) {
+            t = (t + 1) % n;
+        }
+        if (i == 0) {
+            l = t;
+        }
+        while (dot(h[(l + 1) % n] - h[l], u) < 0.0) {
+            l = (l + 1) % n;
+        }
+
+        const double left = dot(h[l] - h[i], u);
+        const double right = dot(h[r] - h[i], u);
+        const double height = dot(h[t] - h[i], v);
+        const double value = metric(right - left, height);
+        if (value < best) {
+            best = value;
+            best_corners[0] = h[i] + u * left;
+            best_corners[1] = h[i] + u * right;
+            best_corners[2] = best_corners[1] + v * height;
+            best_corners[3] = best_corners[0] + v * height;
+        }
+    }
+
+    Polygon rect;
+    rect.vertices.reserve(4);
+    for (const auto& c : best_corners) {
+        rect.add_vertex(to_point(c, z));
+    }
+    return rect;
+}
+
+} // namespace
+
+std::pair<Point, Point> farthest_pair(const Polygon& hull) {
+    const std::vector<V2> h = ccw_hull(hull);
+    const std::size_t n = h.size();
+    const float z = hull.vertices.empty() ? 0.0f : hull.vertices.front().z;
+    if (n == 0) {
+        return {Point(), Point()};
+    }
+    if (n == 1) {
+        return {to_point(h[0], z), to_point(h[0], z)};
+    }
+
+    std::size_t best_a = 0, best_b = 1;
+    double best = dot(h[1] - h[0], h[1] - h[0]);
+    const auto consider = [&](std::size_t a, std::size_t b) {
+        const V2 d = h[b] - h[a];
+        const double dist = dot(d, d);
+        if (dist > best) {
+            best = dist;
+            best_a = a;
+            best_b = b;
+        }
+    };
+
+    // 对每条边找到对踵点：三角形面积随 j 单峰变化
+    std::size_t j = 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        const V2& a = h[i];
+        const V2& b = h[(i + 1) % n];
+        const V2 e = b - a;
+        while (cross(e, h[(j + 1) % n] - a) > cross(e, h[j] - a)) {
+            j = (j + 1) % n;
+        }
+        consider(i, j);
+        consider((i + 1) % n, j);
+    }
+
+    return {to_point(h[best_a], z), to_point(h[best_b], z)};
+}
+
+float diameter(const Polygon& hull) {
+    const auto [a, b] = farthest_pair(hull);
+    return static_cast<float>(a.distance_to(b));
+}
+
+float minimum_width(const Polygon& hull) {
+    const std::vector<V2> h = ccw_hull(hull);
+    const std::size_t n = h.size();
+    if (n < 3) {
+        return 0.0f;
+    }
+
+    double best = std::numeric_limits<double>::max();
+    std::size_t j = 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        const V2& a = h[i];
+        const V2 e = h[(i + 1) % n] - a;
+        const double len = std::hypot(e.x, e.y);
+        if (len == 0.0) {
+            continue;
+        }
+        while (cross(e, h[(j + 1) % n] - a) > cross(e, h[j] - a)) {
+            j = (j + 1) % n;
+        }
+        best = std::min(best, cross(e, h[j] - a) / len);
+    }
+    return static_cast<float>(best);
+}
+
+Polygon min_area_rectangle(const Polygon& hull) {
+    return min_rectangle(hull, [](double width, double height) { return width * height; });
+}
+
+Polygon min_perimeter_rectangle(const Polygon& hull) {
+    return min_rectangle(hull, [](double width, double height) { return width + height; });
+}
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,379 @@
+#include "utils/ccd.h"
+#include "utils/parallel.h"
+#include "utils/proximity.h"
+#include "utils/utils.h"
+#include "geometry/BoundingBox.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+using IndexPair = std::pair<std::uint32_t, std::uint32_t>;
+
+constexpr std::size_t kPairChunk = 64;
+
+void check_options(const ToiOptions& options) {
+    if (!(options.tolerance > 0.0f)) {
+        throw std::invalid_argument("Time-of-impact tolerance must be positive");
+    }
+    if (options.max_iterations == 0) {
+        throw std::invalid_argument("Time-of-impact iteration limit must be positive");
+    }
+}
+
+void check_motion(const std::vector<Line>& from, const std::vector<Line>& to) {
+    if (from.size() != to.size()) {
+        throw std::invalid_argument("Segment start and end poses must have the same size");
+    }
+    if (from.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("Too many segments for continuous collision detection");
+    }
+}
+
+// 端点匀速运动的线段：t 时刻端点为 from 的端点加上 t 倍的位移
+struct SweptSegment {
+    Line from;
+    Point start_motion;
+    Point end_motion;
+
+    SweptSegment(const Line& from, const Line& to) noexcept
+        : from(from), start_motion(to.start - from.start), end_motion(to.end - from.end) {}
+
+    [[nodiscard]] Line at(double time) const noexcept {
+        return Line(from.start + start_motion * time, from.end + end_motion * time);
+    }
+};
+
+// 当前距离与可以安全前进的时间（+inf 表示以后不会接触）
+struct Probe {
+    SegmentClosestPoints closest;
+    double step = std::numeric_limits<double>::infinity();
+};
+
+inline Point flatten(const Point& p) {
+    return Point(p.x, p.y, 0.0f);
+}
+
+inline Line flatten(const Line& line) {
+    return Line(flatten(line.start), flatten(line.end));
+}
+
+// 双精度三维向量，用于安全步长的计算
+struct Vec3 {
+    double x, y, z;
+};
+
+inline Vec3 to_vec(const Point& p) noexcept {
+    return Vec3{p.x, p.y, p.z};
+}
+
+inline Vec3 operator-(const Vec3& a, const Vec3& b) noexcept {
+    return Vec3{a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+inline Vec3 operator+(const Vec3& a, const Vec3& b) noexcept {
+    return Vec3{a.x + b.x, a.y + b.y, a.z + b.z};
+}
+
+inline Vec3 operator*(const Vec3& a, double s) noexcept {
+    return Vec3{a.x * s, a.y * s, a.z * s};
+}
+
+inline double dot(const Vec3& a, const Vec3& b) noexcept {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+// 线段 p0p1 与 q0q1 之间由最近点 p 指向 q 的向量（双精度，端点重合的退化情况也适用）
+Vec3 closest_offset(const Vec3& p0, const Vec3& p1, const Vec3& q0, const Vec3& q1) noexcept {
+    const Vec3 d1 = p1 - p0, d2 = q1 - q0, r = p0 - q0;
+    const double a = dot(d1, d1), e = dot(d2, d2), f = dot(d2, r);
+    double s = 0.0, t = 0.0;
+    if (a <= 0.0 && e <= 0.0) {
+        return q0 - p0;
+    }
+    if (a <= 0.0) {
+        t = std::clamp(f / e, 0.0, 1.0);
+    } else {
+        const double c = dot(d1, r);
+        if (e <= 0.0) {
+            s = std::clamp(-c / a, 0.0, 1.0);
+        } else {
+            const double b = dot(d1, d2);
+            const double denom = a * e - b * b;
+            s = denom > 0.0 ? std::clamp((b * f - c * e) / denom, 0.0, 1.0) : 0.0;
+            t = (b * s + f) / e;
+            if (t < 0.0) {
+                t = 0.0;
+                s = std::clamp(-c / a, 0.0, 1.0);
+            } else if (t > 1.0) {
+                t = 1.0;
+                s = std::clamp((b - c) / a, 0.0, 1.0);
+            }
+        }
+    }
+    return (q0 + d2 * t) - (p0 + d1 * s);
+}
+
+// 两条运动线段的距离降到 margin 之前至少还能前进的时间：
+// 1. 两线段上任意两点的相对速度是四个端点组合相对速度的凸组合，不超过其中的最大值 v，
+//    距离 d 至少需要 (d - margin) / v 时间才能降到 margin；
+// 2. 沿单位方向 n 的分离距离不小于四个端点组合间隙的最小值，而每个间隙是 t 的线性函数。
+//    n 取双精度重新求出的最近点方向。只有四个间隙都严格大于 margin、且间隙最小的组合正在靠近时
+//    才使用这个界（平移运动时一步到达距离为 margin 的时刻），此时两个下界都成立，取较大者；
+//    否则只用第一个界
+double safe_step(const SweptSegment& a, const SweptSegment& b, double time, double margin) {
+    const Vec3 a_motion[2] = {to_vec(a.start_motion), to_vec(a.end_motion)};
+    const Vec3 b_motion[2] = {to_vec(b.start_motion), to_vec(b.end_motion)};
+    const Vec3 a_points[2] = {to_vec(a.from.start) + a_motion[0] * time, to_vec(a.from.end) + a_motion[1] * time};
+    const Vec3 b_points[2] = {to_vec(b.from.start) + b_motion[0] * time, to_vec(b.from.end) + b_motion[1] * time};
+
+    double speed = 0.0;
+    for (const Vec3& va : a_motion) {
+        for (const Vec3& vb : b_motion) {
+            const Vec3 v = vb - va;
+            speed = std::max(speed, std::sqrt(dot(v, v)));
+        }
+    }
+    const Vec3 n = closest_offset(a_points[0], a_points[1], b_points[0], b_points[1]);
+    const double length = std::sqrt(dot(n, n));
+    const double step = speed > 0.0 ? (length - margin) / speed : std::numeric_limits<double>::infinity();
+
+    if (!(length > 0.0)) {
+        return step;
+    }
+    double min_gap = std::numeric_limits<double>::infinity();
+    double min_gap_rate = 0.0;
+    double separation_step = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 2; ++j) {
+            const double gap = dot(b_points[j] - a_points[i], n) / length;
+            const double rate = dot(b_motion[j] - a_motion[i], n) / length;
+            if (!(gap > margin)) {
+                return step;
+            }
+            if (gap < min_gap) {
+                min_gap = gap;
+                min_gap_rate = rate;
+            }
+            if (rate < 0.0) {
+                separation_step = std::min(separation_step, (gap - margin) / -rate);
+            }
+        }
+    }
+    return min_gap_rate < 0.0 ? std::max(step, separation_step) : step;
+}
+
+Probe probe_segments(const SweptSegment& a, const SweptSegment& b, double time, double margin) {
+    const auto closest = segment_closest_points(a.at(time), b.at(time));
+    return Probe{closest, safe_step(a, b, time, margin)};
+}
+
+// xy 平面上线段与多边形区域之间的最近点。从外部进入多边形必先碰到边界，
+// 所以安全前进时间取各条边的最小值，非凸多边形也成立
+Probe probe_polygon(const SweptSegment& segment, const Polygon& polygon, double time, double margin) {
+    const Line current = segment.at(time);
+    if (polygon.contains_point(current.start)) {
+        return Probe{SegmentClosestPoints{current.start, current.start, 0.0f, 0.0f, 0.0f}, 0.0};
+    }
+    if (polygon.contains_point(current.end)) {
+        return Probe{SegmentClosestPoints{current.end, current.end, 1.0f, 0.0f, 0.0f}, 0.0};
+    }
+    Probe best;
+    best.closest.distance = std::numeric_limits<float>::infinity();
+    const auto& vertices = polygon.vertices;
+    for (std::size_t i = 0; i < vertices.size(); ++i) {
+        const Line edge(flatten(vertices[i]), flatten(vertices[(i + 1) % vertices.size()]));
+        const auto closest = segment_closest_points(current, edge);
+        if (closest.distance < best.closest.distance) {
+            best.closest = closest;
+        }
+        best.step = std::min(best.step, safe_step(segment, SweptSegment(edge, edge), time, margin));
+    }
+    return best;
+}
+
+// 保守前进：每一步前进到距离可能降到 tolerance / 2 之前，直到距离不超过 tolerance。每步至少前进
+// (tolerance / 2) / v，一定会结束；时刻超过 limit 时放弃（limit 不大于1）。
+// 迭代次数用完时返回 converged 为 false 的结果，其时刻只是接触时刻的下界
+template <typename ProbeAt>
+std::optional<TimeOfImpact> advance(ProbeAt&& probe_at, const ToiOptions& options, double limit) {
+    const double margin = 0.5 * static_cast<double>(options.tolerance);
+    double time = 0.0;
+    for (std::size_t iteration = 1;; ++iteration) {
+        const Probe probe = probe_at(time, margin);
+        const bool converged = probe.closest.distance <= options.tolerance;
+        if (converged || iteration >= options.max_iterations) {
+            return TimeOfImpact{static_cast<float>(time), probe.closest.first, probe.closest.second,
+                                probe.closest.distance, iteration, converged};
+        }
+        time += probe.step;
+        if (!(time <= limit)) {
+            return std::nullopt;
+        }
+    }
+}
+
+std::optional<TimeOfImpact> segments_impact(const Line& from, const Line& to, const Line& other_from,
+                                            const Line& other_to, const ToiOptions& options, double limit) {
+    const SweptSegment a(from, to), b(other_from, other_to);
+    return advance([&](double time, double margin) { return probe_segments(a, b, time, margin); }, options, limit);
+}
+
+std::optional<TimeOfImpact> polygon_impact(const Line& from, const Line& to, const Polygon& polygon,
+                                           const ToiOptions& options, double limit) {
+    if (polygon.vertices.empty()) {
+        return std::nullopt;
+    }
+    const SweptSegment segment(flatten(from), flatten(to));
+    return advance([&](double time, double margin) { return probe_polygon(segment, polygon, time, margin); },
+                   options, limit);
+}
+
+inline BoundingBox swept_box(const Line& from, const Line& to, float margin) {
+    BoundingBox box(from.start, from.start);
+    box.expand(from.end);
+    box.expand(to.start);
+    box.expand(to.end);
+    box.min = box.min - Point(margin, margin, margin);
+    box.max = box.max + Point(margin, margin, margin);
+    return box;
+}
+
+// 并行求每个候选对的接触时刻，各线程共享当前最早时刻用于剪枝。被剪掉的候选对的
+// 接触时刻一定晚于最终结果，因此结果与线程划分无关
+template <typename Query>
+std::optional<PairImpact> earliest_of(const std::vector<IndexPair>& pairs, Query&& query) {
+    std::vector<std::optional<TimeOfImpact>> results(pairs.size());
+    std::atomic<float> earliest{1.0f};
+    parallel_for(pairs.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t k = begin; k < end; ++k) {
+            results[k] = query(pairs[k], earliest.load(std::memory_order_relaxed));
+            if (!results[k]) {
+                continue;
+            }
+            float current = earliest.load(std::memory_order_relaxed);
+            while (results[k]->time < current && !earliest.compare_exchange_weak(current, results[k]->time)) {
+            }
+        }
+    }, kPairChunk);
+
+    std::optional<PairImpact> best;
+    for (std::size_t k = 0; k < pairs.size(); ++k) {
+        if (!results[k]) {
+            continue;
+        }
+        if (!best || results[k]->time < best->impact.time
+            || (results[k]->time == best->impact.time && pairs[k] < IndexPair(best->first, best->second))) {
+            best = PairImpact{pairs[k].first, pairs[k].second, *results[k]};
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+std::optional<TimeOfImpact> time_of_impact(const Line& from, const Line& to, const Line& other_from,
+                                           const Line& other_to, const ToiOptions& options) {
+    check_options(options);
+    return segments_impact(from, to, other_from, other_to, options, 1.0);
+}
+
+std::optional<TimeOfImpact> time_of_impact(const Line& from, const Line& to, const Polygon& polygon,
+                                           const ToiOptions& options) {
+    check_options(options);
+    return polygon_impact(from, to, polygon, options, 1.0);
+}
+
+std::optional<TimeOfImpact> time_of_impact(const Point& from, const Point& to, const Polygon& polygon,
+                                           const ToiOptions& options) {
+    return time_of_impact(Line(from, from), Line(to, to), polygon, options);
+}
+
+std::vector<std::pair<std::uint32_t, std::uint32_t>> swept_box_pairs(const std::vector<Line>& from,
+                                                                     const std::vector<Line>& to, float margin) {
+    check_motion(from, to);
+    const std::size_t count = from.size();
+    std::vector<BoundingBox> boxes(count);
+    std::vector<std::uint32_t> order(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        boxes[i] = swept_box(from[i], to[i], margin);
+        order[i] = static_cast<std::uint32_t>(i);
+    }
+    std::sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) {
+        return boxes[a].min.x < boxes[b].min.x || (boxes[a].min.x == boxes[b].min.x && a < b);
+    });
+
+    // 扫描线：active 中保存 x 区间仍可能与后续包围盒重叠的线段
+    std::vector<IndexPair> pairs;
+    std::vector<std::uint32_t> active;
+    for (std::uint32_t i : order) {
+        const BoundingBox& box = boxes[i];
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [&](std::uint32_t a) { return boxes[a].max.x < box.min.x; }),
+                     active.end());
+        for (std::uint32_t a : active) {
+            const BoundingBox& other = boxes[a];
+            if (other.min.y <= box.max.y && box.min.y <= other.max.y && other.min.z <= box.max.z
+                && box.min.z <= other.max.z) {
+                pairs.emplace_back(std::min(a, i), std::max(a, i));
+            }
+        }
+        active.push_back(i);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+std::optional<PairImpact> earliest_impact(const std::vector<Line>& from, const std::vector<Line>& to,
+                                          const std::vector<std::pair<std::uint32_t, std::uint32_t>>& pairs,
+                                          const ToiOptions& options) {
+    check_motion(from, to);
+    check_options(options);
+    for (const auto& pair : pairs) {
+        if (pair.first >= from.size() || pair.second >= from.size()) {
+            throw std::out_of_range("Segment pair index out of range");
+        }
+    }
+    return earliest_of(pairs, [&](const IndexPair& pair, float limit) {
+        return segments_impact(from[pair.first], to[pair.first], from[pair.second], to[pair.second], options, limit);
+    });
+}
+
+std::optional<PairImpact> earliest_impact(const std::vector<Line>& from, const std::vector<Line>& to,
+                                          const std::vector<Polygon>& obstacles, const ToiOptions& options) {
+    check_motion(from, to);
+    check_options(options);
+    if (obstacles.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("Too many obstacles for continuous collision detection");
+    }
+
+    // 粗筛只比较 xy 平面上的包围盒
+    std::vector<BoundingBox> obstacle_boxes(obstacles.size());
+    for (std::size_t k = 0; k < obstacles.size(); ++k) {
+        const auto [low, high] = obstacles[k].bounding_box();
+        obstacle_boxes[k] = BoundingBox(low, high);
+    }
+    std::vector<IndexPair> pairs;
+    for (std::size_t i = 0; i < from.size(); ++i) {
+        const BoundingBox box = swept_box(from[i], to[i], options.tolerance);
+        for (std::size_t k = 0; k < obstacles.size(); ++k) {
+            const BoundingBox& other = obstacle_boxes[k];
+            if (!obstacles[k].vertices.empty() && other.min.x <= box.max.x && box.min.x <= other.max.x
+                && other.min.y <= box.max.y && box.min.y <= other.max.y) {
+                pairs.emplace_back(static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(k));
+            }
+        }
+    }
+    return earliest_of(pairs, [&](const IndexPair& pair, float limit) {
+        return polygon_impact(from[pair.first], to[pair.first], obstacles[pair.second], options, limit);
+    });
+}
+
+} // namespace utils
+} // namespace geometry
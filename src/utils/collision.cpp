@@ -0,0 +1,673 @@
+#include "utils/collision.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+// 内部使用双精度向量，避免单纯形求解时的精度损失
+struct Vec3 {
+    double x = 0.0, y = 0.0, z = 0.0;
+};
+
+inline Vec3 to_vec(const Point& p) { return {p.x, p.y, p.z}; }
+inline Point to_point(const Vec3& v) {
+    return Point(static_cast<float>(v.x), static_cast<float>(v.y), static_cast<float>(v.z));
+}
+inline Vec3 operator+(const Vec3& a, const Vec3& b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+inline Vec3 operator-(const Vec3& a, const Vec3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+inline Vec3 operator-(const Vec3& a) { return {-a.x, -a.y, -a.z}; }
+inline Vec3 operator*(const Vec3& a, double s) { return {a.x * s, a.y * s, a.z * s}; }
+inline double dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline Vec3 cross(const Vec3& a, const Vec3& b) {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+inline double length_sq(const Vec3& a) { return dot(a, a); }
+
+constexpr std::size_t kMaxGjkIterations = 64;
+constexpr std::size_t kMaxEpaIterations = 128;
+constexpr double kRelativeTolerance = 1e-6;
+
+// Minkowski 差 A - B 上的一个顶点
+struct SimplexVertex {
+    Vec3 w;             ///< a - b
+    Vec3 a;             ///< A 上的支撑点
+    Vec3 b;             ///< B 上的支撑点
+    std::size_t ia = 0;
+    std::size_t ib = 0;
+};
+
+struct Simplex {
+    SimplexVertex v[4];
+    double bary[4] = {1.0, 0.0, 0.0, 0.0};
+    std::size_t count = 0;
+};
+
+SimplexVertex support(const ConvexShape& a, const ConvexShape& b, const Vec3& d,
+                      std::size_t hint_a, std::size_t hint_b) {
+    SimplexVertex s;
+    s.ia = a.support(to_point(d), hint_a);
+    s.ib = b.support(to_point(-d), hint_b);
+    s.a = to_vec(a.vertex(s.ia));
+    s.b = to_vec(b.vertex(s.ib));
+    s.w = s.a - s.b;
+    return s;
+}
+
+// 按重心坐标保留非零顶点
+void reduce(Simplex& s, const double* weights, std::size_t count) {
+    Simplex out;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (weights[i] > 0.0) {
+            out.v[out.count] = s.v[i];
+            out.bary[out.count] = weights[i];
+            ++out.count;
+        }
+    }
+    s = out;
+}
+
+// 线段上距离原点最近的点
+void solve2(Simplex& s) {
+    const Vec3 a = s.v[0].w;
+    const Vec3 ab = s.v[1].w - a;
+    const double len = length_sq(ab);
+    double t = len > 0.0 ? -dot(a, ab) / len : 0.0;
+    t = std::clamp(t, 0.0, 1.0);
+    const double w[2] = {1.0 - t, t};
+    if (t <= 0.0) {
+        const double only[2] = {1.0, 0.0};
+        reduce(s, only, 2);
+    } else if (t >= 1.0) {
+        const double only[2] = {0.0, 1.0};
+        reduce(s, only, 2);
+    } else {
+        reduce(s, w, 2);
+    }
+}
+
+// 三角形上距离原点最近的点（Ericson 的区域分类法）
+void solve3(Simplex& s) {
+    const Vec3 a = s.v[0].w, b = s.v[1].w, c = s.v[2].w;
+    const Vec3 ab = b - a, ac = c - a;
+
+    const double d1 = -dot(ab, a), d2 = -dot(ac, a);
+    if (d1 <= 0.0 && d2 <= 0.0) {
+        const double w[3] = {1.0, 0.0, 0.0};
+        reduce(s, w, 3);
+        return;
+    }
+
+    const double d3 = -dot(ab, b), d4 = -dot(ac, b);
+    if (d3 >= 0.0 && d4 <= d3) {
+        const double w[3] = {0.0, 1.0, 0.0};
+        reduce(s, w, 3);
+        return;
+    }
+
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+        const double t = d1 / (d1 - d3);
+        const double w[3] = {1.0 - t, t, 0.0};
+        reduce(s, w, 3);
+        return;
+    }
+
+    const double d5 = -dot(ab, c), d6 = -dot(ac, c);
+    if (d6 >= 0.0 && d5 <= d6) {
+        const double w[3] = {0.0, 0.0, 1.0};
+        reduce(s, w, 3);
+        return;
+    }
+
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+        const double t = d2 / (d2 - d6);
+        const double w[3] = {1.0 - t, 0.0, t};
+        reduce(s, w, 3);
+        return;
+    }
+
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+        const double t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        const double w[3] = {0.0, 1.0 - t, t};
+        reduce(s, w, 3);
+        return;
+    }
+
+    const double sum = va + vb + vc;
+    if (sum <= 0.0) {
+        // 退化三角形：退回到离原点最近的边
+        Simplex best;
+        double best_dist = std::numeric_limits<double>::max();
+        const std::size_t pairs[3][2] = {{0, 1}, {1, 2}, {0, 2}};
+        for (const auto& pair : pairs) {
+            Simplex edge;
+            edge.v[0] = s.v[pair[0]];
+            edge.v[1] = s.v[pair[1]];
+            edge.count = 2;
+            solve2(edge);
+            Vec3 p;
+            for (std::size_t i = 0; i < edge.count; ++i) {
+                p = p + edge.v[i].w * edge.bary[i];
+            }
+            const double dist = length_sq(p);
+            if (dist < best_dist) {
+                best_dist = dist;
+                best = edge;
+            }
+        }
+        s = best;
+        return;
+    }
+
+    const double v = vb / sum;
+    const double w = vc / sum;
+    const double weights[3] = {1.0 - v - w, v, w};
+    reduce(s, weights, 3);
+}
+
+// 四面体上距离原点最近的点；原点在内部时保留全部四个顶点
+void solve4(Simplex& s) {
+    static const std::size_t faces[4][4] = {
+        {0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+
+    bool inside = true;
+    Simplex best;
+    double best_dist = std::numeric_limits<double>::max();
+
+    for (const auto& f : faces) {
+        const Vec3 a = s.v[f[0]].w, b = s.v[f[1]].w, c = s.v[f[2]].w, d = s.v[f[3]].w;
+        const Vec3 n = cross(b - a, c - a);
+        const double sign_origin = -dot(a, n);
+        const double sign_opposite = dot(d - a, n);
+        // 四面体退化时 sign_opposite 为0，此时每个面都需要检查
+        if (sign_origin * sign_opposite > 0.0) {
+            continue;
+        }
+        inside = false;
+
+        Simplex tri;
+        tri.v[0] = s.v[f[0]];
+        tri.v[1] = s.v[f[1]];
+        tri.v[2] = s.v[f[2]];
+        tri.count = 3;
+        solve3(tri);
+        Vec3 p;
+        for (std::size_t i = 0; i < tri.count; ++i) {
+            p = p + tri.v[i].w * tri.bary[i];
+        }
+        const double dist = length_sq(p);
+        if (dist < best_dist) {
+            best_dist = dist;
+            best = tri;
+        }
+    }
+
+    if (inside) {
+        // 原点在四面体内部：重心坐标为把对应顶点换成原点后的子四面体与原四面体的有向体积之比，
+        // 这样两个形状上的最近点重合于同一个公共点
+        const Vec3 a = s.v[0].w, ab = s.v[1].w - a, ac = s.v[2].w - a, ad = s.v[3].w - a;
+        const Vec3 ao = -a;
+        const double volume = dot(cross(ab, ac), ad);
+        s.bary[1] = dot(cross(ao, ac), ad) / volume;
+        s.bary[2] = dot(cross(ab, ao), ad) / volume;
+        s.bary[3] = dot(cross(ab, ac), ao) / volume;
+        s.bary[0] = 1.0 - s.bary[1] - s.bary[2] - s.bary[3];
+        return;
+    }
+    s = best;
+}
+
+void solve(Simplex& s) {
+    switch (s.count) {
+    case 1:
+        s.bary[0] = 1.0;
+        break;
+    case 2:
+        solve2(s);
+        break;
+    case 3:
+        solve3(s);
+        break;
+    default:
+        solve4(s);
+        break;
+    }
+}
+
+Vec3 closest_on_simplex(const Simplex& s) {
+    Vec3 p;
+    for (std::size_t i = 0; i < s.count; ++i) {
+        p = p + s.v[i].w * s.bary[i];
+    }
+    return p;
+}
+
+struct GjkState {
+    Simplex simplex;
+    Vec3 v;
+    bool overlapping = false;
+    std::size_t iterations = 0;
+};
+
+GjkState run_gjk(const ConvexShape& a, const ConvexShape& b, GjkCache* cache) {
+    GjkState state;
+    Simplex& s = state.simplex;
+    std::size_t hint_a = 0;
+    std::size_t hint_b = 0;
+
+    if (cache != nullptr && cache->count > 0 && cache->count <= 4) {
+        // 用缓存的顶点下标重建单纯形（使用形状当前的位置）
+        for (std::size_t i = 0; i < cache->count; ++i) {
+            const std::size_t ia = std::min(cache->index_a[i], a.vertices.size() - 1);
+            const std::size_t ib = std::min(cache->index_b[i], b.vertices.size() - 1);
+            SimplexVertex& sv = s.v[i];
+            sv.ia = ia;
+            sv.ib = ib;
+            sv.a = to_vec(a.vertex(ia));
+            sv.b = to_vec(b.vertex(ib));
+            sv.w = sv.a - sv.b;
+        }
+        s.count = cache->count;
+        hint_a = cache->index_a[0];
+        hint_b = cache->index_b[0];
+        solve(s);
+    } else {
+        s.v[0] = support(a, b, to_vec(a.vertex(0) - b.vertex(0)), 0, 0);
+        s.count = 1;
+        s.bary[0] = 1.0;
+    }
+
+    state.v = closest_on_simplex(s);
+    double max_norm = 0.0;
+    for (std::size_t i = 0; i < s.count; ++i) {
+        max_norm = std::max(max_norm, length_sq(s.v[i].w));
+    }
+
+    for (; state.iterations < kMaxGjkIterations; ++state.iterations) {
+        if (s.count == 4) {
+            state.overlapping = true;
+            break;
+        }
+
+        const double vv = length_sq(state.v);
+        if (vv <= 1e-12 * std::max(max_norm, 1e-12)) {
+            state.overlapping = true;
+            break;
+        }
+
+        hint_a = s.v[s.count - 1].ia;
+        hint_b = s.v[s.count - 1].ib;
+        const SimplexVertex w = support(a, b, -state.v, hint_a, hint_b);
+
+        // 收敛判定：新支撑点不能使距离明显下降
+        if (vv - dot(state.v, w.w) <= kRelativeTolerance * vv) {
+            break;
+        }
+
+        bool duplicate = false;
+        for (std::size_t i = 0; i < s.count; ++i) {
+            if (s.v[i].ia == w.ia && s.v[i].ib == w.ib) {
+                duplicate = true;
+                break;
+            }
+        }
+        if (duplicate) {
+            break;
+        }
+
+        s.v[s.count++] = w;
+        max_norm = std::max(max_norm, length_sq(w.w));
+
+        const Simplex previous = s;
+        solve(s);
+        const Vec3 v_new = closest_on_simplex(s);
+        if (s.count < 4 && length_sq(v_new) >= vv) {
+            // 数值上不再下降，保留上一次的单纯形
+            s = previous;
+            s.count = previous.count - 1;
+            solve(s);
+            break;
+        }
+        state.v = v_new;
+    }
+
+    if (cache != nullptr) {
+        cache->count = s.count;
+        for (std::size_t i = 0; i < s.count; ++i) {
+            cache->index_a[i] = s.v[i].ia;
+            cache->index_b[i] = s.v[i].ib;
+        }
+    }
+    return state;
+}
+
+// ===== EPA =====
+
+struct EpaFace {
+    std::size_t i0, i1, i2;
+    Vec3 normal;
+    double dist;
+};
+
+bool make_face(const std::vector<SimplexVertex>& verts, std::size_t i0, std::size_t i1,
+               std::size_t i2, EpaFace& face) {
+    const Vec3 n = cross(verts[i1].w - verts[i0].w, verts[i2].w - verts[i0].w);
+    const double len = std::sqrt(length_sq(n));
+    if (len <= 1e-14) {
+        return false;
+    }
+    face.i0 = i0;
+    face.i1 = i1;
+    face.i2 = i2;
+    face.normal = n * (1.0 / len);
+    face.dist = dot(face.normal, verts[i0].w);
+    return true;
+}
+
+bool contains_vertex(const std::vector<SimplexVertex>& verts, const SimplexVertex& w) {
+    for (const auto& v : verts) {
+        if (length_sq(v.w - w.w) <= 1e-12 * std::max(1.0, length_sq(w.w))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+EpaResult touching_result(const Simplex& s) {
+    EpaResult result;
+    Vec3 pa, pb;
+    for (std::size_t i = 0; i < s.count; ++i) {
+        pa = pa + s.v[i].a * s.bary[i];
+        pb = pb + s.v[i].b * s.bary[i];
+    }
+    result.normal = Point(1.0f, 0.0f, 0.0f);
+    result.depth = 0.0f;
+    result.contact_a = to_point(pa);
+    result.contact_b = to_point(pb);
+    return result;
+}
+
+EpaResult epa_2d(const ConvexShape& a, const ConvexShape& b, const Simplex& s) {
+    std::vector<SimplexVertex> poly(s.v, s.v + s.count);
+
+    // 把单纯形扩展成一个三角形
+    static const Vec3 axes[4] = {{1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
+    for (const auto& axis : axes) {
+        if (poly.size() >= 2) {
+            break;
+        }
+        const SimplexVertex w = support(a, b, axis, poly[0].ia, poly[0].ib);
+        if (!contains_vertex(poly, w)) {
+            poly.push_back(w);
+        }
+    }
+    if (poly.size() == 2) {
+        const Vec3 e = poly[1].w - poly[0].w;
+        const Vec3 perp{-e.y, e.x, 0.0};
+        for (const Vec3& d : {perp, -perp}) {
+            const SimplexVertex w = support(a, b, d, poly[0].ia, poly[0].ib);
+            if (std::abs(cross(e, w.w - poly[0].w).z) > 1e-12 * std::max(1.0, length_sq(e))) {
+                poly.push_back(w);
+                break;
+            }
+        }
+    }
+    if (poly.size() < 3) {
+        return touching_result(s);
+    }
+    poly.resize(3);
+    if (cross(poly[1].w - poly[0].w, poly[2].w - poly[0].w).z < 0.0) {
+        std::swap(poly[1], poly[2]);
+    }
+
+    std::size_t best_edge = 0;
+    Vec3 best_normal;
+    double best_dist = 0.0;
+    for (std::size_t iter = 0; iter < kMaxEpaIterations; ++iter) {
+        best_dist = std::numeric_limits<double>::max();
+        for (std::size_t i = 0; i < poly.size(); ++i) {
+            const Vec3 e = poly[(i + 1) % poly.size()].w - poly[i].w;
+            const double len = std::hypot(e.x, e.y);
+            if (len <= 1e-14) {
+                continue;
+            }
+            const Vec3 n{e.y / len, -e.x / len, 0.0};
+            const double dist = dot(n, poly[i].w);
+            if (dist < best_dist) {
+                best_dist = dist;
+                best_edge = i;
+                best_normal = n;
+            }
+        }
+
+        const SimplexVertex w = support(a, b, best_normal, poly[best_edge].ia, poly[best_edge].ib);
+        if (dot(w.w, best_normal) - best_dist <= kRelativeTolerance * std::max(1.0, best_dist)
+            || contains_vertex(poly, w)) {
+            break;
+        }
+        poly.insert(poly.begin() + static_cast<std::ptrdiff_t>(best_edge + 1), w);
+    }
+
+    const SimplexVertex& p0 = poly[best_edge];
+    const SimplexVertex& p1 = poly[(best_edge + 1) % poly.size()];
+    const Vec3 e = p1.w - p0.w;
+    const double len = length_sq(e);
+    const double t = len > 0.0 ? std::clamp(-dot(p0.w, e) / len, 0.0, 1.0) : 0.0;
+
+    EpaResult result;
+    result.normal = to_point(best_normal);
+    result.depth = static_cast<float>(std::max(best_dist, 0.0));
+    result.contact_a = to_point(p0.a * (1.0 - t) + p1.a * t);
+    result.contact_b = to_point(p0.b * (1.0 - t) + p1.b * t);
+    return result;
+}
+
+EpaResult epa_3d(const ConvexShape& a, const ConvexShape& b, const Simplex& s) {
+    std::vector<SimplexVertex> verts(s.v, s.v + s.count);
+
+    // 把单纯形扩展成一个非退化的四面体
+    static const Vec3 axes[6] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+    for (const auto& axis : axes) {
+        if (verts.size() >= 2) {
+            break;
+        }
+        const SimplexVertex w = support(a, b, axis, verts[0].ia, verts[0].ib);
+        if (!contains_vertex(verts, w)) {
+            verts.push_back(w);
+        }
+    }
+    if (verts.size() == 2) {
+        const Vec3 e = verts[1].w - verts[0].w;
+        Vec3 axis{1, 0, 0};
+        if (std::abs(e.y) < std::abs(e.x) && std::abs(e.y) <= std::abs(e.z)) {
+            axis = {0, 1, 0};
+        } else if (std::abs(e.z) < std::abs(e.x)) {
+            axis = {0, 0, 1};
+        }
+        const Vec3 u = cross(e, axis);
+        const Vec3 v = cross(e, u) * (1.0 / std::sqrt(std::max(length_sq(e), 1e-300)));
+        for (const Vec3& d : {u, -u, v, -v}) {
+            const SimplexVertex w = support(a, b, d, verts[0].ia, verts[0].ib);
+            if (length_sq(cross(e, w.w - verts[0].w)) > 1e-20 * std::max(1.0, length_sq(e))) {
+                verts.push_back(w);
+                break;
+            }
+        }
+    }
+    if (verts.size() == 3) {
+        const Vec3 n = cross(verts[1].w - verts[0].w, verts[2].w - verts[0].w);
+        for (const Vec3& d : {n, -n}) {
+            const SimplexVertex w = support(a, b, d, verts[0].ia, verts[0].ib);
+            if (std::abs(dot(n, w.w - verts[0].w)) > 1e-12 * std::max(1.0, length_sq(n))) {
+                verts.push_back(w);
+                break;
+            }
+        }
+    }
+    if (verts.size() < 4) {
+        return touching_result(s);
+    }
+
+    // 保证四面体的朝向为正，使所有面法向量朝外
+    if (dot(cross(verts[1].w - verts[0].w, verts[2].w - verts[0].w), verts[3].w - verts[0].w) > 0.0) {
+        std::swap(verts[1], verts[2]);
+    }
+
+    std::vector<EpaFace> faces;
+    const std::size_t init[4][3] = {{0, 1, 2}, {0, 3, 1}, {0, 2, 3}, {1, 3, 2}};
+    for (const auto& f : init) {
+        EpaFace face;
+        if (make_face(verts, f[0], f[1], f[2], face)) {
+            faces.push_back(face);
+        }
+    }
+    if (faces.size() < 4) {
+        return touching_result(s);
+    }
+
+    std::size_t best = 0;
+    std::vector<std::pair<std::size_t, std::size_t>> horizon;
+    for (std::size_t iter = 0; iter < kMaxEpaIterations; ++iter) {
+        best = 0;
+        for (std::size_t i = 1; i < faces.size(); ++i) {
+            if (faces[i].dist < faces[best].dist) {
+                best = i;
+            }
+        }
+
+        const EpaFace face = faces[best];
+        const SimplexVertex w = support(a, b, face.normal, verts[face.i0].ia, verts[face.i0].ib);
+        if (dot(w.w, face.normal) - face.dist <= kRelativeTolerance * std::max(1.0, face.dist)
+            || contains_vertex(verts, w)) {
+            break;
+        }
+
+        const std::size_t wi = verts.size();
+        verts.push_back(w);
+
+        // 删除所有对新顶点可见的面，并收集地平线边
+        horizon.clear();
+        for (std::size_t i = 0; i < faces.size();) {
+            const EpaFace& f = faces[i];
+            if (dot(f.normal, w.w - verts[f.i0].w) > 0.0) {
+                const std::pair<std::size_t, std::size_t> edges[3] = {
+                    {f.i0, f.i1}, {f.i1, f.i2}, {f.i2, f.i0}};
+                for (const auto& e : edges) {
+                    auto it = std::find(horizon.begin(), horizon.end(),
+                                        std::make_pair(e.second, e.first));
+                    if (it != horizon.end()) {
+                        horizon.erase(it);
+                    } else {
+                        horizon.push_back(e);
+                    }
+                }
+                faces[i] = faces.back();
+                faces.pop_back();
+            } else {
+                ++i;
+            }
+        }
+
+        for (const auto& e : horizon) {
+            EpaFace f;
+            if (make_face(verts, e.first, e.second, wi, f)) {
+                faces.push_back(f);
+            }
+        }
+        if (faces.empty()) {
+            faces.push_back(face);
+            break;
+        }
+    }
+
+    best = 0;
+    for (std::size_t i = 1; i < faces.size(); ++i) {
+        if (faces[i].dist < faces[best].dist) {
+            best = i;
+        }
+    }
+    const EpaFace& face = faces[best];
+
+    // 原点在最近面上的投影的重心坐标
+    Simplex tri;
+    tri.v[0] = verts[face.i0];
+    tri.v[1] = verts[face.i1];
+    tri.v[2] = verts[face.i2];
+    const Vec3 p = face.normal * face.dist;
+    const Vec3 v0 = tri.v[1].w - tri.v[0].w, v1 = tri.v[2].w - tri.v[0].w, v2 = p - tri.v[0].w;
+    const double d00 = dot(v0, v0), d01 = dot(v0, v1), d11 = dot(v1, v1);
+    const double d20 = dot(v2, v0), d21 = dot(v2, v1);
+    const double denom = d00 * d11 - d01 * d01;
+    double u = 1.0 / 3.0, v = 1.0 / 3.0;
+    if (std::abs(denom) > 1e-300) {
+        u = (d11 * d20 - d01 * d21) / denom;
+        v = (d00 * d21 - d01 * d20) / denom;
+    }
+    const double w0 = 1.0 - u - v;
+
+    EpaResult result;
+    result.normal = to_point(face.normal);
+    result.depth = static_cast<float>(std::max(face.dist, 0.0));
+    result.contact_a = to_point(tri.v[0].a * w0 + tri.v[1].a * u + tri.v[2].a * v);
+    result.contact_b = to_point(tri.v[0].b * w0 + tri.v[1].b * u + tri.v[2].b * v);
+    return result;
+}
+
+} // namespace
+
+GjkResult gjk_distance(const ConvexShape& a, const ConvexShape& b, GjkCache* cache) {
+    GjkResult result;
+    if (a.vertices.empty() || b.vertices.empty()) {
+        return result;
+    }
+
+    const GjkState state = run_gjk(a, b, cache);
+    const Simplex& s = state.simplex;
+
+    Vec3 pa, pb;
+    for (std::size_t i = 0; i < s.count; ++i) {
+        pa = pa + s.v[i].a * s.bary[i];
+        pb = pb + s.v[i].b * s.bary[i];
+    }
+
+    result.overlapping = state.overlapping;
+    result.distance = state.overlapping ? 0.0f : static_cast<float>(std::sqrt(length_sq(state.v)));
+    result.closest_a = to_point(pa);
+    result.closest_b = to_point(pb);
+    result.iterations = state.iterations;
+    return result;
+}
+
+bool gjk_intersects(const ConvexShape& a, const ConvexShape& b, GjkCache* cache) {
+    return gjk_distance(a, b, cache).overlapping;
+}
+
+std::optional<EpaResult> epa_penetration(const ConvexShape& a, const ConvexShape& b, GjkCache* cache) {
+    if (a.vertices.empty() || b.vertices.empty()) {
+        return std::nullopt;
+    }
+
+    const GjkState state = run_gjk(a, b, cache);
+    if (!state.overlapping) {
+        return std::nullopt;
+    }
+
+    // Minkowski 差在 z 方向没有厚度时使用2D扩展
+    const Vec3 up{0, 0, 1};
+    const double z_max = dot(to_vec(a.vertex(a.support(to_point(up)))) - to_vec(b.vertex(b.support(to_point(-up)))), up);
+    const double z_min = dot(to_vec(a.vertex(a.support(to_point(-up)))) - to_vec(b.vertex(b.support(to_point(up)))), up);
+    if (z_max - z_min <= 1e-9 * std::max(1.0, std::abs(z_max) + std::abs(z_min))) {
+        return epa_2d(a, b, state.simplex);
+    }
+    return epa_3d(a, b, state.simplex);
+}
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,991 @@
+#include "utils/delaunay.h"
+#include "utils/predicates.h"
+#include "utils/spacefill.h"
+#include "utils/utils.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <utility>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+struct V2 {
+    double x = 0.0, y = 0.0;
+};
+
+// 虚拟顶点：凸包边与它组成的虚拟三角形覆盖凸包外部
+constexpr std::uint32_t kGhost = 0xFFFFFFFFu;
+constexpr std::uint32_t kNone = 0xFFFFFFFFu;
+constexpr std::size_t kNoEdge = std::numeric_limits<std::size_t>::max();
+
+// 加密时新点之间的最小间距（相对于包围盒尺寸），保证输出为 float 后仍互不重合
+constexpr double kMinRelativeLength = 1.0 / 262144.0;
+// 单次空腔检查最多访问的三角形数
+constexpr std::size_t kMaxCavity = 256;
+
+using VertexPair = std::pair<std::uint32_t, std::uint32_t>;
+
+inline double orient(const V2& a, const V2& b, const V2& c) {
+    return orient2d(a.x, a.y, b.x, b.y, c.x, c.y);
+}
+
+inline double incircle(const V2& a, const V2& b, const V2& c, const V2& d) {
+    return utils::incircle(a.x, a.y, b.x, b.y, c.x, c.y, d.x, d.y);
+}
+
+inline double dot(const V2& o, const V2& a, const V2& b) {
+    return (a.x - o.x) * (b.x - o.x) + (a.y - o.y) * (b.y - o.y);
+}
+
+inline bool opposite_signs(double a, double b) {
+    return (a > 0.0 && b < 0.0) || (a < 0.0 && b > 0.0);
+}
+
+inline V2 circumcenter(const V2& a, const V2& b, const V2& c) {
+    const double bx = b.x - a.x, by = b.y - a.y;
+    const double cx = c.x - a.x, cy = c.y - a.y;
+    const double bl = bx * bx + by * by;
+    const double cl = cx * cx + cy * cy;
+    const double d = 0.5 / (bx * cy - by * cx);
+    return {a.x + (cy * bl - by * cl) * d, a.y + (bx * cl - cx * bl) * d};
+}
+
+inline std::size_t next_edge(std::size_t e) { return e % 3 == 2 ? e - 2 : e + 1; }
+inline std::size_t prev_edge(std::size_t e) { return e % 3 == 0 ? e + 2 : e - 1; }
+
+class DelaunayBuilder {
+public:
+    explicit DelaunayBuilder(std::vector<V2>& pts) : pts_(pts) {
+        // n 个点的三角剖分（含虚拟三角形）恰好有 2n - 2 个三角形
+        triangles_.reserve(pts.size() * 6);
+        halfedges_.reserve(pts.size() * 6);
+    }
+
+    void start(std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+        const std::size_t t = add_triangle(a, b, c);
+        const std::uint32_t verts[3] = {a, b, c};
+        std::size_t ghosts[3];
+        for (std::size_t k = 0; k < 3; ++k) {
+            ghosts[k] = add_triangle(verts[(k + 1) % 3], verts[k], kGhost);
+            link(3 * t + k, 3 * ghosts[k]);
+        }
+        for (std::size_t k = 0; k < 3; ++k) {
+            link(3 * ghosts[k] + 1, 3 * ghosts[(k + 2) % 3] + 2);
+        }
+        last_ = t;
+    }
+
+    void insert(std::uint32_t index) {
+        const V2& p = pts_[index];
+        const std::size_t t = locate(p);
+        if (!is_ghost(t)) {
+            for (std::size_t k = 0; k < 3; ++k) {
+                const V2& v = pts_[triangles_[3 * t + k]];
+                if (v.x == p.x && v.y == p.y) {
+                    return; // 重复点
+                }
+            }
+        }
+        split(t, index);
+        last_ = t;
+    }
+
+    // 开启约束边支持：为每条半边记录约束标记，为每个顶点记录一条出边
+    void enable_constraints() {
+        constraints_ = true;
+        constrained_.assign(triangles_.size(), 0);
+        vertex_edge_.assign(pts_.size(), kNone);
+        for (std::size_t e = 0; e < triangles_.size(); ++e) {
+            touch(e);
+        }
+    }
+
+    // 插入约束边 ab：先翻掉所有与 ab 相交的边（Sloan 翻边队列），再对新边做 Lawson 翻边。
+    // 与已有约束边相交或数值问题导致无法恢复时返回 false
+    bool insert_segment(std::uint32_t a, std::uint32_t b) {
+        for (std::size_t guard = 0; a != b; ++guard) {
+            if (guard > pts_.size() || vertex_edge_[a] == kNone) {
+                return false;
+            }
+
+            // 绕 a 旋转：找到边 ab、恰好位于 ab 上的顶点，或 ab 穿过的第一条边
+            const std::size_t start = vertex_edge_[a];
+            std::size_t e = start;
+            std::size_t cross = kNoEdge;
+            std::uint32_t reached = kNone;
+            do {
+                const std::uint32_t v = triangles_[next_edge(e)];
+                const std::uint32_t w = triangles_[prev_edge(e)];
+                if (v == b) {
+                    reached = v;
+                    break;
+                }
+                if (v != kGhost) {
+                    const double side = orient(pts_[a], pts_[v], pts_[b]);
+                    if (side == 0.0 && dot(pts_[a], pts_[v], pts_[b]) > 0.0) {
+                        reached = v;
+                        break;
+                    }
+                    if (w != kGhost && side > 0.0 && orient(pts_[a], pts_[w], pts_[b]) < 0.0) {
+                        cross = next_edge(e);
+                        break;
+                    }
+                }
+                e = halfedges_[prev_edge(e)];
+            } while (e != start);
+
+            if (reached != kNone) {
+                mark(e);
+                a = reached;
+                continue;
+            }
+            if (cross == kNoEdge) {
+                return false;
+            }
+
+            // 沿 ab 穿过各个三角形，记录被穿过的边（右端点, 左端点），直到到达 b 或 ab 上的某个顶点
+            crossings_.clear();
+            std::uint32_t stop = kNone;
+            while (stop == kNone) {
+                if (is_constrained(cross) || crossings_.size() > triangles_.size()) {
+                    return false;
+                }
+                crossings_.emplace_back(triangles_[cross], triangles_[next_edge(cross)]);
+                const std::size_t twin = halfedges_[cross];
+                const std::uint32_t x = triangles_[prev_edge(twin)];
+                if (x == kGhost) {
+                    return false;
+                }
+                const double side = x == b ? 0.0 : orient(pts_[a], pts_[b], pts_[x]);
+                if (side == 0.0) {
+                    stop = x;
+                } else {
+                    cross = side > 0.0 ? next_edge(twin) : prev_edge(twin);
+                }
+            }
+            if (!resolve_crossings(a, stop)) {
+                return false;
+            }
+            a = stop;
+        }
+        return true;
+    }
+
+    // 从虚拟三角形出发做 0-1 广度优先搜索：每穿过一条约束边深度加一，深度为奇数的三角形在区域内部
+    void classify() {
+        const std::size_t count = triangles_.size() / 3;
+        std::vector<std::uint32_t> depth(count, kNone);
+        std::deque<std::uint32_t> queue;
+        for (std::size_t t = 0; t < count; ++t) {
+            if (is_ghost(t)) {
+                depth[t] = 0;
+                queue.push_back(static_cast<std::uint32_t>(t));
+            }
+        }
+        while (!queue.empty()) {
+            const std::uint32_t t = queue.front();
+            queue.pop_front();
+            for (std::size_t k = 0; k < 3; ++k) {
+                const std::size_t e = 3 * t + k;
+                const std::uint32_t n = halfedges_[e] / 3;
+                const std::uint32_t d = depth[t] + constrained_[e];
+                if (d < depth[n]) {
+                    depth[n] = d;
+                    if (constrained_[e]) {
+                        queue.push_back(n);
+                    } else {
+                        queue.push_front(n);
+                    }
+                }
+            }
+        }
+
+        inside_.resize(count);
+        for (std::size_t t = 0; t < count; ++t) {
+            inside_[t] = depth[t] != kNone && (depth[t] & 1u) != 0;
+        }
+        classified_ = true;
+    }
+
+    // Ruppert 式加密：优先在中点分割被侵占的约束边，否则在质量差的三角形外心插入新点。
+    // 新点的 z 坐标在所在三角形（或约束边）上线性插值，并追加到 points 末尾
+    void refine(std::vector<Point>& points, double min_angle, std::size_t max_steiner) {
+        const double sine = std::sin(min_angle);
+        quality_ = 1.0 / (4.0 * sine * sine);
+
+        double min_x = pts_[0].x, max_x = min_x, min_y = pts_[0].y, max_y = min_y;
+        for (const auto& p : pts_) {
+            min_x = std::min(min_x, p.x);
+            max_x = std::max(max_x, p.x);
+            min_y = std::min(min_y, p.y);
+            max_y = std::max(max_y, p.y);
+        }
+        const double floor = std::max(max_x - min_x, max_y - min_y) * kMinRelativeLength;
+        min_length_sq_ = floor * floor;
+
+        segments_.clear();
+        bad_.clear();
+        for (std::size_t e = 0; e < triangles_.size(); ++e) {
+            if (is_constrained(e) && e < halfedges_[e]) {
+                segments_.emplace_back(triangles_[e], triangles_[next_edge(e)]);
+            }
+        }
+        for (std::size_t t = 0; t < inside_.size(); ++t) {
+            if (inside_[t]) {
+                bad_.push_back(static_cast<std::uint32_t>(t));
+            }
+        }
+
+        std::size_t added = 0;
+        while (added < max_steiner) {
+            if (!segments_.empty()) {
+                const VertexPair segment = segments_.back();
+                segments_.pop_back();
+                const std::size_t e = find_edge(segment.first, segment.second);
+                if (e != kNoEdge && is_constrained(e) && encroached(e) && splittable(e) && split_segment(e, points)) {
+                    ++added;
+                }
+                continue;
+            }
+            if (bad_.empty()) {
+                break;
+            }
+            const std::uint32_t t = bad_.front();
+            bad_.pop_front();
+            if (inside_[t] && is_bad(t)) {
+                added += insert_circumcenter(t, points);
+            }
+        }
+    }
+
+    Triangulation finish(const std::vector<Point>& points) const {
+        Triangulation result;
+        result.points = points;
+
+        const std::size_t count = triangles_.size() / 3;
+        std::vector<std::int32_t> remap(count, -1);
+        std::int32_t real = 0;
+        for (std::size_t t = 0; t < count; ++t) {
+            if (!is_ghost(t) && (!classified_ || inside_[t])) {
+                remap[t] = real++;
+            }
+        }
+
+        result.triangles.reserve(static_cast<std::size_t>(real) * 3);
+        result.halfedges.reserve(static_cast<std::size_t>(real) * 3);
+        for (std::size_t t = 0; t < count; ++t) {
+            if (remap[t] < 0) {
+                continue;
+            }
+            for (std::size_t k = 0; k < 3; ++k) {
+                const std::size_t twin = halfedges_[3 * t + k];
+                result.triangles.push_back(triangles_[3 * t + k]);
+                const std::int32_t other = remap[twin / 3];
+                result.halfedges.push_back(other < 0 ? -1 : other * 3 + static_cast<std::int32_t>(twin % 3));
+            }
+        }
+        return result;
+    }
+
+private:
+    std::vector<V2>& pts_;
+    std::vector<std::uint32_t> triangles_;
+    std::vector<std::uint32_t> halfedges_;
+    std::vector<std::size_t> stack_;
+    std::size_t last_ = 0;
+
+    // 以下只在约束三角剖分中使用
+    bool constraints_ = false;
+    bool classified_ = false;
+    std::vector<std::uint8_t> constrained_;  ///< 每条半边是否为约束边
+    std::vector<std::uint32_t> vertex_edge_; ///< 每个顶点的一条出边
+    std::vector<std::uint8_t> inside_;       ///< 每个三角形是否在区域内部
+    std::vector<VertexPair> crossings_, flipped_, segments_, encroached_;
+    std::deque<std::uint32_t> bad_;
+    std::vector<std::uint32_t> cavity_;
+    double quality_ = 0.0;
+    double min_length_sq_ = 0.0;
+
+    std::size_t add_triangle(std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+        const std::size_t t = triangles_.size() / 3;
+        triangles_.insert(triangles_.end(), {a, b, c});
+        halfedges_.insert(halfedges_.end(), 3, 0);
+        if (constraints_) {
+            constrained_.insert(constrained_.end(), 3, 0);
+            for (std::size_t k = 0; k < 3; ++k) {
+                touch(3 * t + k);
+            }
+        }
+        if (classified_) {
+            inside_.push_back(0);
+        }
+        return t;
+    }
+
+    // 新点先以 float 精度追加到 points 末尾，内部坐标取自舍入后的值，使输出与内部计算一致。
+    // 直接写成 double -> float -> double 的往返转换时，GCC 12 -O2 的向量化会把舍入优化掉
+    V2 stage_point(std::vector<Point>& points, double x, double y) const {
+        points.emplace_back(static_cast<float>(x), static_cast<float>(y));
+        return {points.back().x, points.back().y};
+    }
+
+    std::uint32_t add_point(const V2& p) {
+        pts_.push_back(p);
+        vertex_edge_.push_back(kNone);
+        return static_cast<std::uint32_t>(pts_.size() - 1);
+    }
+
+    void link(std::size_t a, std::size_t b) {
+        halfedges_[a] = static_cast<std::uint32_t>(b);
+        halfedges_[b] = static_cast<std::uint32_t>(a);
+    }
+
+    // 记录半边 e 为其起点的出边
+    void touch(std::size_t e) {
+        if (constraints_ && triangles_[e] != kGhost) {
+            vertex_edge_[triangles_[e]] = static_cast<std::uint32_t>(e);
+        }
+    }
+
+    void mark(std::size_t e) {
+        constrained_[e] = 1;
+        constrained_[halfedges_[e]] = 1;
+    }
+
+    bool is_constrained(std::size_t e) const {
+        return constraints_ && constrained_[e] != 0;
+    }
+
+    bool is_ghost(std::size_t t) const {
+        return triangles_[3 * t] == kGhost || triangles_[3 * t + 1] == kGhost || triangles_[3 * t + 2] == kGhost;
+    }
+
+    // 绕顶点 u 旋转，查找从 u 指向 v 的半边
+    std::size_t find_edge(std::uint32_t u, std::uint32_t v) const {
+        const std::size_t start = vertex_edge_[u];
+        if (start == kNone) {
+            return kNoEdge;
+        }
+        std::size_t e = start;
+        do {
+            if (triangles_[next_edge(e)] == v) {
+                return e;
+            }
+            e = halfedges_[prev_edge(e)];
+        } while (e != start);
+        return kNoEdge;
+    }
+
+    // 可见性行走：穿过 p 位于其右侧的边，直到 p 落在某个实三角形内或走出凸包
+    std::size_t locate(const V2& p) const {
+        std::size_t t = last_;
+        if (is_ghost(t)) {
+            for (std::size_t k = 0; k < 3; ++k) {
+                if (triangles_[3 * t + k] != kGhost && triangles_[3 * t + (k + 1) % 3] != kGhost) {
+                    t = halfedges_[3 * t + k] / 3;
+                    break;
+                }
+            }
+        }
+
+        const std::size_t limit = triangles_.size();
+        for (std::size_t step = 0; step < limit; ++step) {
+            bool moved = false;
+            for (std::size_t k = 0; k < 3; ++k) {
+                const std::size_t e = 3 * t + (k + step) % 3;
+                const V2& a = pts_[triangles_[e]];
+                const V2& b = pts_[triangles_[next_edge(e)]];
+                if (orient(a, b, p) < 0.0) {
+                    t = halfedges_[e] / 3;
+                    moved = true;
+                    break;
+                }
+            }
+            if (!moved || is_ghost(t)) {
+                return t;
+            }
+        }
+        return locate_linear(p);
+    }
+
+    // 舍入误差导致行走不收敛时的兜底：线性扫描所有三角形
+    std::size_t locate_linear(const V2& p) const {
+        const std::size_t count = triangles_.size() / 3;
+        std::size_t visible_ghost = count;
+        for (std::size_t t = 0; t < count; ++t) {
+            if (is_ghost(t)) {
+                for (std::size_t k = 0; k < 3; ++k) {
+                    const std::uint32_t a = triangles_[3 * t + k];
+                    const std::uint32_t b = triangles_[3 * t + (k + 1) % 3];
+                    if (a != kGhost && b != kGhost && orient(pts_[a], pts_[b], p) > 0.0) {
+                        visible_ghost = t;
+                    }
+                }
+                continue;
+            }
+            const V2& a = pts_[triangles_[3 * t]];
+            const V2& b = pts_[triangles_[3 * t + 1]];
+            const V2& c = pts_[triangles_[3 * t + 2]];
+            if (orient(a, b, p) >= 0.0 && orient(b, c, p) >= 0.0 && orient(c, a, p) >= 0.0) {
+                return t;
+            }
+        }
+        return visible_ghost < count ? visible_ghost : last_;
+    }
+
+    // 把三角形 t 分成以新点 p 为公共顶点的三个三角形，然后翻边恢复 Delaunay 性质
+    void split(std::size_t t, std::uint32_t p) {
+        const std::uint32_t v0 = triangles_[3 * t], v1 = triangles_[3 * t + 1], v2 = triangles_[3 * t + 2];
+        const std::size_t h1 = halfedges_[3 * t + 1], h2 = halfedges_[3 * t + 2];
+
+        triangles_[3 * t + 2] = p;
+        const std::size_t t1 = add_triangle(v1, v2, p);
+        const std::size_t t2 = add_triangle(v2, v0, p);
+
+        link(3 * t1, h1);
+        link(3 * t2, h2);
+        link(3 * t + 1, 3 * t1 + 2);
+        link(3 * t + 2, 3 * t2 + 1);
+        link(3 * t1 + 1, 3 * t2 + 2);
+
+        if (constraints_) {
+            constrained_[3 * t1] = constrained_[3 * t + 1];
+            constrained_[3 * t2] = constrained_[3 * t + 2];
+            constrained_[3 * t + 1] = constrained_[3 * t + 2] = 0;
+        }
+        if (classified_) {
+            inside_[t1] = inside_[t2] = inside_[t];
+        }
+
+        legalize(3 * t);
+        legalize(3 * t1);
+        legalize(3 * t2);
+    }
+
+    // 在边 e 上的点 p 处把两侧三角形各分成两个，约束标记由两段子边继承
+    void split_edge(std::size_t e, std::uint32_t p) {
+        const std::size_t a = e, b = halfedges_[e];
+        const std::size_t al = next_edge(a), ar = prev_edge(a);
+        const std::size_t bl = prev_edge(b), br = next_edge(b);
+        const std::uint32_t x = triangles_[a], y = triangles_[al], u = triangles_[ar], v = triangles_[bl];
+        const std::size_t hal = halfedges_[al], hbr = halfedges_[br];
+
+        triangles_[al] = p;
+        triangles_[br] = p;
+        const std::size_t t1 = add_triangle(p, y, u);
+        const std::size_t t2 = add_triangle(p, x, v);
+
+        link(3 * t1 + 1, hal);
+        link(al, 3 * t1 + 2);
+        link(3 * t2 + 1, hbr);
+        link(br, 3 * t2 + 2);
+        link(a, 3 * t2);
+        link(b, 3 * t1);
+
+        if (constraints_) {
+            constrained_[3 * t1] = constrained_[3 * t2] = constrained_[a];
+            constrained_[3 * t1 + 1] = constrained_[al];
+            constrained_[3 * t2 + 1] = constrained_[br];
+            constrained_[al] = constrained_[br] = 0;
+            touch(al);
+            touch(br);
+        }
+        if (classified_) {
+            inside_[t1] = inside_[a / 3];
+            inside_[t2] = inside_[b / 3];
+        }
+
+        legalize(ar);
+        legalize(3 * t1 + 1);
+        legalize(bl);
+        legalize(3 * t2 + 1);
+    }
+
+    // 翻转半边 a 与其反向半边共享的对角线；翻转后新对角线位于 prev_edge(a) 与 prev_edge(b)
+    void flip(std::size_t a) {
+        const std::size_t b = halfedges_[a];
+        const std::size_t al = next_edge(a);
+        const std::size_t ar = prev_edge(a);
+        const std::size_t bl = prev_edge(b);
+        const std::size_t br = next_edge(b);
+
+        triangles_[a] = triangles_[bl];
+        triangles_[b] = triangles_[ar];
+        const std::size_t hbl = halfedges_[bl];
+        const std::size_t har = halfedges_[ar];
+        link(a, hbl);
+        link(b, har);
+        link(ar, bl);
+
+        if (constraints_) {
+            constrained_[a] = constrained_[bl];
+            constrained_[b] = constrained_[ar];
+            constrained_[ar] = constrained_[bl] = 0;
+            for (std::size_t h : {a, al, ar, b, br, bl}) {
+                touch(h);
+            }
+        }
+    }
+
+    // 三角形 (x, y, z) 的外接圆（虚拟三角形为开半平面）是否严格包含 d
+    bool illegal(std::uint32_t x, std::uint32_t y, std::uint32_t z, std::uint32_t d) const {
+        if (x == kGhost) {
+            return orient(pts_[y], pts_[z], pts_[d]) > 0.0;
+        }
+        if (y == kGhost) {
+            return orient(pts_[z], pts_[x], pts_[d]) > 0.0;
+        }
+        const double area = orient(pts_[x], pts_[y], pts_[z]);
+        if (area == 0.0) {
+            // 新点恰好落在边 xy 上：退化三角形必须翻掉
+            return true;
+        }
+        if (d == kGhost) {
+            return false;
+        }
+        return incircle(pts_[x], pts_[y], pts_[z], pts_[d]) > 0.0;
+    }
+
+    // 翻转半边 a 后得到的两个三角形是否都为正向；舍入误差下近乎退化的四边形可能不满足
+    bool convex(std::size_t a) const {
+        const std::size_t b = halfedges_[a];
+        const std::uint32_t pr = triangles_[a], pl = triangles_[next_edge(a)];
+        const std::uint32_t p0 = triangles_[prev_edge(a)], p1 = triangles_[prev_edge(b)];
+        if (pr == kGhost || pl == kGhost || p0 == kGhost || p1 == kGhost) {
+            return true;
+        }
+        return orient(pts_[p1], pts_[pl], pts_[p0]) > 0.0 && orient(pts_[p0], pts_[pr], pts_[p1]) > 0.0;
+    }
+
+    // 翻转以新点为顶点的三角形中不合法的对边；约束边不参与翻转
+    void legalize(std::size_t edge) {
+        stack_.push_back(edge);
+        while (!stack_.empty()) {
+            const std::size_t a = stack_.back();
+            stack_.pop_back();
+            if (is_constrained(a)) {
+                continue;
+            }
+            const std::size_t b = halfedges_[a];
+            if (!illegal(triangles_[a], triangles_[next_edge(a)], triangles_[prev_edge(a)], triangles_[prev_edge(b)])
+                || !convex(a)) {
+                continue;
+            }
+            const std::size_t br = next_edge(b);
+            flip(a);
+            stack_.push_back(a);
+            stack_.push_back(br);
+        }
+    }
+
+    // 翻掉 crossings_ 中所有与 ab 相交的边，然后标记 ab 为约束边并恢复周围的 Delaunay 性质
+    bool resolve_crossings(std::uint32_t a, std::uint32_t b) {
+        std::deque<VertexPair> queue(crossings_.begin(), crossings_.end());
+        flipped_.clear();
+        // Sloan 的方法最多需要 O(k^2) 次翻转
+        std::size_t budget = queue.size() * queue.size() * 4 + 64;
+        while (!queue.empty()) {
+            if (budget-- == 0) {
+                return false;
+            }
+            const VertexPair edge = queue.front();
+            queue.pop_front();
+            const std::size_t e = find_edge(edge.first, edge.second);
+            if (e == kNoEdge) {
+                return false;
+            }
+            const std::uint32_t p = triangles_[prev_edge(e)];
+            const std::uint32_t q = triangles_[prev_edge(halfedges_[e])];
+            if (p == kGhost || q == kGhost) {
+                return false;
+            }
+            // 只有四边形严格凸时才能翻转，否则放回队尾稍后再试
+            if (!opposite_signs(orient(pts_[p], pts_[q], pts_[edge.first]),
+                                orient(pts_[p], pts_[q], pts_[edge.second]))) {
+                queue.push_back(edge);
+                continue;
+            }
+            flip(e);
+            const bool touches = p == a || p == b || q == a || q == b;
+            if (!touches && opposite_signs(orient(pts_[a], pts_[b], pts_[p]), orient(pts_[a], pts_[b], pts_[q]))) {
+                queue.emplace_back(p, q);
+            } else {
+                flipped_.emplace_back(p, q);
+            }
+        }
+
+        const std::size_t e = find_edge(a, b);
+        if (e == kNoEdge) {
+            return false;
+        }
+        mark(e);
+
+        // 对新产生的边做 Lawson 翻边
+        while (!flipped_.empty()) {
+            const VertexPair edge = flipped_.back();
+            flipped_.pop_back();
+            const std::size_t f = find_edge(edge.first, edge.second);
+            if (f == kNoEdge || is_constrained(f)) {
+                continue;
+            }
+            const std::uint32_t r = triangles_[prev_edge(f)];
+            const std::uint32_t s = triangles_[prev_edge(halfedges_[f])];
+            if (r == kGhost || s == kGhost
+                || incircle(pts_[edge.first], pts_[edge.second], pts_[r], pts_[s]) <= 0.0 || !convex(f)) {
+                continue;
+            }
+            flip(f);
+            flipped_.emplace_back(edge.second, r);
+            flipped_.emplace_back(r, edge.first);
+            flipped_.emplace_back(edge.first, s);
+            flipped_.emplace_back(s, edge.second);
+        }
+        return true;
+    }
+
+    // 约束边 e 是否被区域内一侧的对顶点侵占（对顶点位于以 e 为直径的圆内）
+    bool encroached(std::size_t e) const {
+        for (std::size_t h : {e, static_cast<std::size_t>(halfedges_[e])}) {
+            if (!inside_[h / 3]) {
+                continue;
+            }
+            const V2& w = pts_[triangles_[prev_edge(h)]];
+            if (dot(w, pts_[triangles_[h]], pts_[triangles_[next_edge(h)]]) < 0.0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool splittable(std::size_t e) const {
+        const V2& u = pts_[triangles_[e]];
+        const V2& v = pts_[triangles_[next_edge(e)]];
+        const double dx = v.x - u.x, dy = v.y - u.y;
+        return dx * dx + dy * dy > 4.0 * min_length_sq_;
+    }
+
+    // 外接圆半径与最短边之比超过界限的三角形；两条约束边之间的小输入角无法通过加密改善，予以跳过
+    bool is_bad(std::size_t t) const {
+        const V2& a = pts_[triangles_[3 * t]];
+        const V2& b = pts_[triangles_[3 * t + 1]];
+        const V2& c = pts_[triangles_[3 * t + 2]];
+        const double area = orient(a, b, c);
+        if (area <= 0.0) {
+            return false;
+        }
+        const double lengths[3] = {
+            (b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y),
+            (c.x - b.x) * (c.x - b.x) + (c.y - b.y) * (c.y - b.y),
+            (a.x - c.x) * (a.x - c.x) + (a.y - c.y) * (a.y - c.y),
+        };
+        const std::size_t k = static_cast<std::size_t>(
+            std::min_element(lengths, lengths + 3) - lengths);
+        const double shortest = lengths[k];
+        if (shortest < min_length_sq_) {
+            return false;
+        }
+        const double radius_sq = lengths[0] * lengths[1] * lengths[2] / (4.0 * area * area);
+        if (radius_sq <= quality_ * shortest) {
+            return false;
+        }
+        return !(constrained_[3 * t + (k + 1) % 3] && constrained_[3 * t + (k + 2) % 3]);
+    }
+
+    // 在中点分割约束边 e；中点舍入为 float 精度后会产生反向三角形时放弃分割
+    bool split_segment(std::size_t e, std::vector<Point>& points) {
+        const std::uint32_t x = triangles_[e];
+        const std::uint32_t y = triangles_[next_edge(e)];
+        const V2 mid = stage_point(points, (pts_[x].x + pts_[y].x) * 0.5, (pts_[x].y + pts_[y].y) * 0.5);
+        for (std::size_t h : {e, static_cast<std::size_t>(halfedges_[e])}) {
+            const std::uint32_t apex = triangles_[prev_edge(h)];
+            if (apex == kGhost) {
+                continue;
+            }
+            const V2& from = pts_[triangles_[h]];
+            const V2& to = pts_[triangles_[next_edge(h)]];
+            if (orient(from, mid, pts_[apex]) <= 0.0 || orient(mid, to, pts_[apex]) <= 0.0) {
+                points.pop_back();
+                return false;
+            }
+        }
+        points.back().z = (points[x].z + points[y].z) * 0.5f;
+        const std::uint32_t p = add_point(mid);
+        split_edge(e, p);
+        enqueue_fan(p);
+        return true;
+    }
+
+    // 尝试在三角形 t 的外心插入新点；外心被约束边挡住或侵占约束边时改为分割这些约束边。
+    // 返回新增的点数
+    std::size_t insert_circumcenter(std::uint32_t t, std::vector<Point>& points) {
+        const V2& a = pts_[triangles_[3 * t]];
+        const V2& b = pts_[triangles_[3 * t + 1]];
+        const V2& c = pts_[triangles_[3 * t + 2]];
+        const V2 center = circumcenter(a, b, c);
+        const V2 origin{(a.x + b.x + c.x) / 3.0, (a.y + b.y + c.y) / 3.0};
+
+        // 沿重心到外心的直线行走，遇到约束边即停止
+        std::size_t current = t;
+        std::size_t entry = kNoEdge;
+        std::size_t blocked = kNoEdge;
+        for (std::size_t step = 0;; ++step) {
+            if (step > triangles_.size() || !inside_[current]) {
+                return 0;
+            }
+            std::size_t exit = kNoEdge;
+            for (std::size_t k = 0; k < 3; ++k) {
+                const std::size_t e = 3 * current + k;
+                if (e != entry && orient(origin, center, pts_[triangles_[e]]) <= 0.0
+                    && orient(origin, center, pts_[triangles_[next_edge(e)]]) >= 0.0) {
+                    exit = e;
+                    break;
+                }
+            }
+            if (exit == kNoEdge
+                || orient(pts_[triangles_[exit]], pts_[triangles_[next_edge(exit)]], center) >= 0.0) {
+                break;
+            }
+            if (is_constrained(exit)) {
+                blocked = exit;
+                break;
+            }
+            entry = halfedges_[exit];
+            current = entry / 3;
+        }
+
+        if (blocked != kNoEdge) {
+            if (!splittable(blocked) || !split_segment(blocked, points)) {
+                return 0;
+            }
+            bad_.push_back(t);
+            return 1;
+        }
+
+        // 空腔检查：外心位于某条约束边的直径圆内时，改为分割这些约束边
+        encroached_.clear();
+        cavity_.assign(1, static_cast<std::uint32_t>(current));
+        for (std::size_t i = 0; i < cavity_.size() && cavity_.size() < kMaxCavity; ++i) {
+            for (std::size_t k = 0; k < 3; ++k) {
+                const std::size_t e = 3 * cavity_[i] + k;
+                const std::uint32_t u = triangles_[e], v = triangles_[next_edge(e)];
+                if (is_constrained(e)) {
+                    if (dot(center, pts_[u], pts_[v]) < 0.0) {
+                        encroached_.emplace_back(u, v);
+                    }
+                    continue;
+                }
+                const std::uint32_t n = halfedges_[e] / 3;
+                if (is_ghost(n) || std::find(cavity_.begin(), cavity_.end(), n) != cavity_.end()) {
+                    continue;
+                }
+                if (incircle(pts_[triangles_[3 * n]], pts_[triangles_[3 * n + 1]], pts_[triangles_[3 * n + 2]],
+                             center) > 0.0) {
+                    cavity_.push_back(n);
+                }
+            }
+        }
+        if (!encroached_.empty()) {
+            std::size_t added = 0;
+            while (!encroached_.empty()) {
+                const VertexPair segment = encroached_.back();
+                encroached_.pop_back();
+                const std::size_t e = find_edge(segment.first, segment.second);
+                if (e != kNoEdge && is_constrained(e) && splittable(e) && split_segment(e, points)) {
+                    ++added;
+                }
+            }
+            if (added > 0) {
+                bad_.push_back(t);
+            }
+            return added;
+        }
+
+        // 舍入后的外心必须仍在三角形内且不与顶点重合，z 按重心坐标插值
+        const std::uint32_t i0 = triangles_[3 * current];
+        const std::uint32_t i1 = triangles_[3 * current + 1];
+        const std::uint32_t i2 = triangles_[3 * current + 2];
+        const V2 site = stage_point(points, center.x, center.y);
+        const double area = orient(pts_[i0], pts_[i1], pts_[i2]);
+        const double w0 = orient(pts_[i1], pts_[i2], site);
+        const double w1 = orient(pts_[i2], pts_[i0], site);
+        const double w2 = orient(pts_[i0], pts_[i1], site);
+        if (area <= 0.0 || w0 < 0.0 || w1 < 0.0 || w2 < 0.0 || (w0 == 0.0) + (w1 == 0.0) + (w2 == 0.0) > 1) {
+            points.pop_back();
+            return 0;
+        }
+        points.back().z = static_cast<float>((w0 * points[i0].z + w1 * points[i1].z + w2 * points[i2].z) / area);
+        const std::uint32_t p = add_point(site);
+        split(current, p);
+        enqueue_fan(p);
+        return 1;
+    }
+
+    // 把新点周围的三角形加入质量检查队列，把其对边中的约束边加入侵占检查队列
+    void enqueue_fan(std::uint32_t p) {
+        const std::size_t start = vertex_edge_[p];
+        std::size_t e = start;
+        do {
+            const std::size_t t = e / 3;
+            if (inside_[t]) {
+                bad_.push_back(static_cast<std::uint32_t>(t));
+            }
+            const std::size_t opposite = next_edge(e);
+            if (is_constrained(e)) {
+                segments_.emplace_back(p, triangles_[opposite]);
+            }
+            if (is_constrained(opposite)) {
+                segments_.emplace_back(triangles_[opposite], triangles_[prev_edge(e)]);
+            }
+            e = halfedges_[prev_edge(e)];
+        } while (e != start);
+    }
+};
+
+// 有偏随机插入顺序：随机打乱后分成规模逐轮翻倍的若干轮，每轮内部按 Hilbert 曲线排序
+std::vector<std::uint32_t> brio_order(const std::vector<Point>& points, std::uint32_t seed) {
+    const std::size_t n = points.size();
+    std::vector<std::uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0u);
+    std::mt19937 rng(seed);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    const std::vector<std::uint64_t> codes = curve_codes(points, CurveType::Hilbert, 2);
+    const auto by_code = [&codes](std::uint32_t a, std::uint32_t b) { return codes[a] < codes[b]; };
+
+    std::size_t end = n;
+    while (end > 0) {
+        const std::size_t begin = end > 64 ? end / 2 : 0;
+        std::sort(order.begin() + static_cast<std::ptrdiff_t>(begin), order.begin() + static_cast<std::ptrdiff_t>(end),
+                  by_code);
+        end = begin;
+    }
+    return order;
+}
+
+// 以第一个非退化三角形为起点，按 order 依次插入所有点；所有点共线（或重合）时返回 false
+bool triangulate(DelaunayBuilder& builder, const std::vector<V2>& pts, const std::vector<std::uint32_t>& order) {
+    const std::size_t n = order.size();
+    if (n < 3) {
+        return false;
+    }
+    std::size_t i1 = 1;
+    while (i1 < n && pts[order[i1]].x == pts[order[0]].x && pts[order[i1]].y == pts[order[0]].y) {
+        ++i1;
+    }
+    std::size_t i2 = i1 + 1;
+    while (i2 < n && orient(pts[order[0]], pts[order[i1]], pts[order[i2]]) == 0.0) {
+        ++i2;
+    }
+    if (i2 >= n) {
+        return false;
+    }
+
+    std::uint32_t a = order[0], b = order[i1], c = order[i2];
+    if (orient(pts[a], pts[b], pts[c]) < 0.0) {
+        std::swap(b, c);
+    }
+    builder.start(a, b, c);
+    for (std::size_t k = 1; k < n; ++k) {
+        if (k != i1 && k != i2) {
+            builder.insert(order[k]);
+        }
+    }
+    return true;
+}
+
+// 把坐标相同的顶点合并为一个（-0 与 +0 视为相同）
+std::uint64_t vertex_key(const Point& p) {
+    const float x = p.x + 0.0f, y = p.y + 0.0f;
+    std::uint32_t bx = 0, by = 0;
+    std::memcpy(&bx, &x, sizeof(bx));
+    std::memcpy(&by, &y, sizeof(by));
+    return (static_cast<std::uint64_t>(bx) << 32) | by;
+}
+
+} // namespace
+
+Triangulation delaunay(const std::vector<Point>& points, std::uint32_t seed) {
+    std::vector<V2> pts(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        pts[i] = {points[i].x, points[i].y};
+    }
+
+    DelaunayBuilder builder(pts);
+    if (!triangulate(builder, pts, brio_order(points, seed))) {
+        Triangulation empty;
+        empty.points = points;
+        return empty;
+    }
+    return builder.finish(points);
+}
+
+Triangulation constrained_delaunay(const PolygonWithHoles& polygon, float min_angle, std::size_t max_steiner) {
+    // 合并各条边界上的重复顶点，每条边界上相邻的两个顶点构成一条约束边
+    std::vector<Point> points;
+    std::vector<VertexPair> segments;
+    points.reserve(polygon.vertex_count());
+    segments.reserve(polygon.vertex_count());
+    std::unordered_map<std::uint64_t, std::uint32_t> index;
+    index.reserve(polygon.vertex_count());
+    std::vector<std::uint32_t> ring_ids;
+    const auto add_ring = [&](const Polygon& ring) {
+        const std::size_t m = ring.vertices.size();
+        if (m < 3) {
+            return;
+        }
+        ring_ids.resize(m);
+        for (std::size_t i = 0; i < m; ++i) {
+            const auto found = index.emplace(vertex_key(ring.vertices[i]), static_cast<std::uint32_t>(points.size()));
+            if (found.second) {
+                points.push_back(ring.vertices[i]);
+            }
+            ring_ids[i] = found.first->second;
+        }
+        for (std::size_t i = 0; i < m; ++i) {
+            const std::uint32_t a = ring_ids[i], b = ring_ids[(i + 1) % m];
+            if (a != b) {
+                segments.emplace_back(a, b);
+            }
+        }
+    };
+    add_ring(polygon.outer);
+    for (const auto& hole : polygon.holes) {
+        add_ring(hole);
+    }
+
+    std::vector<V2> pts(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        pts[i] = {points[i].x, points[i].y};
+    }
+
+    DelaunayBuilder builder(pts);
+    if (!triangulate(builder, pts, brio_order(points, 0))) {
+        Triangulation empty;
+        empty.points = std::move(points);
+        return empty;
+    }
+    builder.enable_constraints();
+    for (const auto& segment : segments) {
+        // 自相交的边界会导致插入失败，此时跳过该边
+        builder.insert_segment(segment.first, segment.second);
+    }
+    builder.classify();
+
+    if (min_angle > 0.0f) {
+        const float angle = std::min(min_angle, 30.0f);
+        const std::size_t limit = max_steiner > 0 ? max_steiner : 16 * points.size() + 1024;
+        builder.refine(points, degrees_to_radians(angle), limit);
+    }
+    return builder.finish(points);
+}
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,223 @@
+#include "utils/enclosing.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+struct Vec3 {
+    double x = 0.0, y = 0.0, z = 0.0;
+};
+
+inline Vec3 operator+(const Vec3& a, const Vec3& b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+inline Vec3 operator-(const Vec3& a, const Vec3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+inline Vec3 operator*(const Vec3& a, double s) { return {a.x * s, a.y * s, a.z * s}; }
+inline double dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline Vec3 cross(const Vec3& a, const Vec3& b) {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+struct Ball {
+    Vec3 center;
+    double radius_sq = -1.0;
+};
+
+// 相对容差：避免重复点或共圆点因舍入误差反复触发重新计算
+constexpr double kRelativeSlack = 1e-10;
+
+inline bool inside(const Ball& ball, const Vec3& p) {
+    const Vec3 d = p - ball.center;
+    return dot(d, d) <= ball.radius_sq * (1.0 + kRelativeSlack) + 1e-300;
+}
+
+Ball ball_from(const Vec3& a) {
+    return {a, 0.0};
+}
+
+Ball ball_from(const Vec3& a, const Vec3& b) {
+    const Vec3 c = (a + b) * 0.5;
+    const Vec3 d = a - c;
+    return {c, dot(d, d)};
+}
+
+// 过三点的最小球（三点的外接圆）；三点共线时退化为最远两点的直径球
+Ball ball_from(const Vec3& a, const Vec3& b, const Vec3& c) {
+    const Vec3 ab = b - a;
+    const Vec3 ac = c - a;
+    const Vec3 n = cross(ab, ac);
+    const double denom = 2.0 * dot(n, n);
+    const double scale = dot(ab, ab) * dot(ac, ac);
+    if (denom <= 1e-24 * scale || denom == 0.0) {
+        Ball best = ball_from(a, b);
+        for (const Ball& candidate : {ball_from(a, c), ball_from(b, c)}) {
+            if (candidate.radius_sq > best.radius_sq) {
+                best = candidate;
+            }
+        }
+        return best;
+    }
+    const Vec3 offset = (cross(n, ab) * dot(ac, ac) + cross(ac, n) * dot(ab, ab)) * (1.0 / denom);
+    return {a + offset, dot(offset, offset)};
+}
+
+// 过四点的外接球；四点共面时退化为包含第四点的最小三点球
+Ball ball_from(const Vec3& a, const Vec3& b, const Vec3& c, const Vec3& d) {
+    const Vec3 u = b - a, v = c - a, w = d - a;
+    const double det = dot(u, cross(v, w));
+    const double scale = std::sqrt(dot(u, u) * dot(v, v) * dot(w, w));
+    if (std::abs(det) <= 1e-12 * scale) {
+        Ball best;
+        bool found = false;
+        const Ball candidates[4] = {ball_from(a, b, c), ball_from(a, b, d), ball_from(a, c, d), ball_from(b, c, d)};
+        const Vec3 others[4] = {d, c, b, a};
+        for (int i = 0; i < 4; ++i) {
+            if (inside(candidates[i], others[i]) && (!found || candidates[i].radius_sq < best.radius_sq)) {
+                best = candidates[i];
+                found = true;
+            }
+        }
+        return found ? best : candidates[0];
+    }
+    const double uu = 0.5 * dot(u, u), vv = 0.5 * dot(v, v), ww = 0.5 * dot(w, w);
+    const Vec3 offset = (cross(v, w) * uu + cross(w, u) * vv + cross(u, v) * ww) * (1.0 / det);
+    return {a + offset, dot(offset, offset)};
+}
+
+std::vector<Vec3> shuffled(const std::vector<Point>& points, std::uint32_t seed, bool planar) {
+    std::vector<Vec3> pts;
+    pts.reserve(points.size());
+    for (const auto& p : points) {
+        pts.push_back({p.x, p.y, planar ? 0.0 : p.z});
+    }
+    std::mt19937 rng(seed);
+    std::shuffle(pts.begin(), pts.end(), rng);
+    return pts;
+}
+
+// 把双精度的球心转成 float，并重新计算能覆盖全部点的半径
+float covering_radius(const std::vector<Point>& points, const Point& center, bool planar) {
+    double radius_sq = 0.0;
+    for (const auto& p : points) {
+        const double dx = static_cast<double>(p.x) - center.x;
+        const double dy = static_cast<double>(p.y) - center.y;
+        const double dz = planar ? 0.0 : static_cast<double>(p.z) - center.z;
+        radius_sq = std::max(radius_sq, dx * dx + dy * dy + dz * dz);
+    }
+    const float radius = static_cast<float>(std::sqrt(radius_sq));
+    return static_cast<double>(radius) * radius < radius_sq
+        ? std::nextafter(radius, std::numeric_limits<float>::max())
+        : radius;
+}
+
+inline Point to_point(const Vec3& v) {
+    return Point(static_cast<float>(v.x), static_cast<float>(v.y), static_cast<float>(v.z));
+}
+
+// 迭代式 Welzl：外层循环发现新边界点时把它移到队首
+Ball welzl(std::vector<Vec3>& pts, bool planar) {
+    Ball ball = ball_from(pts[0]);
+    for (std::size_t i = 1; i < pts.size(); ++i) {
+        if (inside(ball, pts[i])) {
+            continue;
+        }
+        const Vec3 pi = pts[i];
+        ball = ball_from(pi);
+        for (std::size_t j = 0; j < i; ++j) {
+            if (inside(ball, pts[j])) {
+                continue;
+            }
+            const Vec3 pj = pts[j];
+            ball = ball_from(pi, pj);
+            for (std::size_t k = 0; k < j; ++k) {
+                if (inside(ball, pts[k])) {
+                    continue;
+                }
+                const Vec3 pk = pts[k];
+                ball = ball_from(pi, pj, pk);
+                if (planar) {
+                    continue;
+                }
+                for (std::size_t l = 0; l < k; ++l) {
+                    if (!inside(ball, pts[l])) {
+                        ball = ball_from(pi, pj, pk, pts[l]);
+                    }
+                }
+            }
+        }
+        std::rotate(pts.begin(), pts.begin() + static_cast<std::ptrdiff_t>(i),
+                    pts.begin() + static_cast<std::ptrdiff_t>(i + 1));
+    }
+    return ball;
+}
+
+} // namespace
+
+Circle min_enclosing_circle(const std::vector<Point>& points, std::uint32_t seed) {
+    if (points.empty()) {
+        return Circle();
+    }
+    std::vector<Vec3> pts = shuffled(points, seed, true);
+    const Ball ball = welzl(pts, true);
+    Point center = to_point(ball.center);
+    center.z = points.front().z;
+    return Circle(center, covering_radius(points, center, true));
+}
+
+Sphere min_enclosing_sphere(const std::vector<Point>& points, std::uint32_t seed) {
+    if (points.empty()) {
+        return Sphere();
+    }
+    std::vector<Vec3> pts = shuffled(points, seed, false);
+    const Ball ball = welzl(pts, false);
+    const Point center = to_point(ball.center);
+    return Sphere(center, covering_radius(points, center, false));
+}
+
+Sphere ritter_sphere(const std::vector<Point>& points) {
+    if (points.empty()) {
+        return Sphere();
+    }
+
+    const auto farthest_from = [&points](const Vec3& origin) {
+        Vec3 best{points[0].x, points[0].y, points[0].z};
+        double best_sq = -1.0;
+        for (const auto& p : points) {
+            const Vec3 v{p.x, p.y, p.z};
+            const Vec3 d = v - origin;
+            const double dist = dot(d, d);
+            if (dist > best_sq) {
+                best_sq = dist;
+                best = v;
+            }
+        }
+        return best;
+    };
+
+    const Vec3 x{points[0].x, points[0].y, points[0].z};
+    const Vec3 y = farthest_from(x);
+    const Vec3 z = farthest_from(y);
+
+    Vec3 center = (y + z) * 0.5;
+    double radius = std::sqrt(dot(z - y, z - y)) * 0.5;
+    for (const auto& p : points) {
+        const Vec3 v{p.x, p.y, p.z};
+        const Vec3 d = v - center;
+        const double dist = std::sqrt(dot(d, d));
+        if (dist > radius) {
+            // 扩大球使其恰好包含当前点，球心向该点移动
+            const double new_radius = (radius + dist) * 0.5;
+            center = center + d * ((new_radius - radius) / dist);
+            radius = new_radius;
+        }
+    }
+
+    const Point c = to_point(center);
+    return Sphere(c, covering_radius(points, c, false));
+}
+
+} // namespace utils
+} // namespace geometry
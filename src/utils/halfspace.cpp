@@ -0,0 +1,610 @@
+#include "utils/halfspace.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+struct V3 {
+    double x = 0.0, y = 0.0, z = 0.0;
+};
+
+inline V3 sub(const V3& a, const V3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+inline double dot(const V3& a, const V3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline V3 cross(const V3& a, const V3& b) {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+// ===== Chebyshev 中心：max t s.t. t - n_i·x <= d_i，变量 (x, y, z, t) =====
+
+using Row = std::array<double, 4>;
+
+// 4x4 高斯-约旦求逆（列主元），矩阵奇异时返回 false
+bool invert4(const Row (&m)[4], double (&inv)[4][4]) {
+    double a[4][8];
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            a[r][c] = m[r][c];
+            a[r][c + 4] = (r == c) ? 1.0 : 0.0;
+        }
+    }
+    for (int c = 0; c < 4; ++c) {
+        int pivot = c;
+        for (int r = c + 1; r < 4; ++r) {
+            if (std::abs(a[r][c]) > std::abs(a[pivot][c])) {
+                pivot = r;
+            }
+        }
+        if (std::abs(a[pivot][c]) < 1e-300) {
+            return false;
+        }
+        if (pivot != c) {
+            for (int k = 0; k < 8; ++k) {
+                std::swap(a[c][k], a[pivot][k]);
+            }
+        }
+        const double scale = 1.0 / a[c][c];
+        for (int k = 0; k < 8; ++k) {
+            a[c][k] *= scale;
+        }
+        for (int r = 0; r < 4; ++r) {
+            if (r != c && a[r][c] != 0.0) {
+                const double factor = a[r][c];
+                for (int k = 0; k < 8; ++k) {
+                    a[r][k] -= factor * a[c][k];
+                }
+            }
+        }
+    }
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            inv[r][c] = a[r][c + 4];
+        }
+    }
+    return true;
+}
+
+// 只在工作集 active 上求解的单纯形法：基由4个取等号的约束组成，沿目标 t 增大的棱在顶点之间换基
+void solve_working_set(const std::vector<Row>& rows, const std::vector<double>& rhs,
+                       const std::vector<std::size_t>& active, std::size_t box, double (&y)[4]) {
+    // 初始顶点：x = y = z = bound，t 取工作集内所有约束允许的最小值
+    const double bound = rhs[box];
+    std::size_t basis[4] = {box, box + 2, box + 4, box + 6};
+    double t0 = bound;
+    for (std::size_t i : active) {
+        const double limit = rhs[i] - (rows[i][0] + rows[i][1] + rows[i][2]) * bound;
+        if (i < box && limit < t0) {
+            t0 = limit;
+            basis[3] = i;
+        }
+    }
+    y[0] = y[1] = y[2] = bound;
+    y[3] = t0;
+
+    const std::size_t max_iterations = 100 + 20 * active.size();
+    for (std::size_t iteration = 0; iteration < max_iterations; ++iteration) {
+        Row basis_rows[4];
+        for (int k = 0; k < 4; ++k) {
+            basis_rows[k] = rows[basis[k]];
+        }
+        double inv[4][4];
+        if (!invert4(basis_rows, inv)) {
+            return;
+        }
+        for (int r = 0; r < 4; ++r) {
+            y[r] = 0.0;
+            for (int k = 0; k < 4; ++k) {
+                y[r] += inv[r][k] * rhs[basis[k]];
+            }
+        }
+
+        // 目标为 t，对偶乘子即逆矩阵的最后一行；选约束下标最小的负乘子离开（Bland 规则）
+        int leave = -1;
+        for (int k = 0; k < 4; ++k) {
+            if (inv[3][k] < -1e-12 && (leave < 0 || basis[k] < basis[leave])) {
+                leave = k;
+            }
+        }
+        if (leave < 0) {
+            return;
+        }
+        const double direction[4] = {-inv[0][leave], -inv[1][leave], -inv[2][leave], -inv[3][leave]};
+
+        std::size_t enter = rows.size();
+        double best_step = std::numeric_limits<double>::infinity();
+        for (std::size_t i : active) {
+            if (i == basis[0] || i == basis[1] || i == basis[2] || i == basis[3]) {
+                continue;
+            }
+            const Row& row = rows[i];
+            const double rate = row[0] * direction[0] + row[1] * direction[1] + row[2] * direction[2]
+                                + row[3] * direction[3];
+            if (rate <= 1e-12) {
+                continue;
+            }
+            const double slack = rhs[i] - (row[0] * y[0] + row[1] * y[1] + row[2] * y[2] + row[3] * y[3]);
+            const double step = std::max(0.0, slack) / rate;
+            if (step < best_step || (step == best_step && i < enter)) {
+                best_step = step;
+                enter = i;
+            }
+        }
+        if (enter == rows.size()) {
+            return;
+        }
+        basis[leave] = enter;
+    }
+}
+
+// 最大内切球的线性规划 max t s.t. t - n_i·x <= d_i。约束生成：先在少量平面上求解，
+// 再把全部平面中违反最严重的一批加入工作集重新求解，直到没有违反的平面，全集只需扫描少数几遍
+bool chebyshev_center(const std::vector<Plane>& planes, V3& center, double& radius) {
+    constexpr std::size_t kBatch = 64;
+    double scale = 1.0;
+    for (const Plane& plane : planes) {
+        scale = std::max(scale, static_cast<double>(std::abs(plane.d())));
+    }
+    const double bound = 1e3 * scale;
+
+    std::vector<Row> rows;
+    std::vector<double> rhs;
+    rows.reserve(planes.size() + 7);
+    rhs.reserve(planes.size() + 7);
+    for (const Plane& plane : planes) {
+        rows.push_back({-static_cast<double>(plane.normal.x), -static_cast<double>(plane.normal.y),
+                        -static_cast<double>(plane.normal.z), 1.0});
+        rhs.push_back(plane.d());
+    }
+    // 包围盒 |x|, |y|, |z| <= bound 与 t <= bound，保证每个子问题有界
+    const std::size_t box = rows.size();
+    for (int axis = 0; axis < 3; ++axis) {
+        Row upper{0.0, 0.0, 0.0, 0.0}, lower{0.0, 0.0, 0.0, 0.0};
+        upper[axis] = 1.0;
+        lower[axis] = -1.0;
+        rows.push_back(upper);
+        rhs.push_back(bound);
+        rows.push_back(lower);
+        rhs.push_back(bound);
+    }
+    rows.push_back({0.0, 0.0, 0.0, 1.0});
+    rhs.push_back(bound);
+
+    std::vector<std::size_t> active;
+    std::vector<bool> in_active(planes.size(), false);
+    for (std::size_t i = box; i < rows.size(); ++i) {
+        active.push_back(i);
+    }
+    const std::size_t initial = std::min(kBatch, planes.size());
+    for (std::size_t k = 0; k < initial; ++k) {
+        const std::size_t i = k * planes.size() / initial;
+        active.push_back(i);
+        in_active[i] = true;
+    }
+
+    double y[4] = {0.0, 0.0, 0.0, 0.0};
+    const double tolerance = 1e-9 * scale;
+    std::vector<std::pair<double, std::size_t>> violated;
+    while (true) {
+        solve_working_set(rows, rhs, active, box, y);
+        violated.clear();
+        for (std::size_t i = 0; i < planes.size(); ++i) {
+            const Row& row = rows[i];
+            const double excess = row[0] * y[0] + row[1] * y[1] + row[2] * y[2] + row[3] * y[3] - rhs[i];
+            if (excess > tolerance && !in_active[i]) {
+                violated.emplace_back(excess, i);
+            }
+        }
+        if (violated.empty()) {
+            break;
+        }
+        if (violated.size() > kBatch) {
+            std::nth_element(violated.begin(), violated.begin() + kBatch, violated.end(),
+                             [](const auto& a, const auto& b) { return a.first > b.first; });
+            violated.resize(kBatch);
+        }
+        for (const auto& entry : violated) {
+            active.push_back(entry.second);
+            in_active[entry.second] = true;
+        }
+    }
+
+    center = {y[0], y[1], y[2]};
+    radius = y[3];
+    // 数值误差可能使顶点略微不可行，按实际到各平面的最小距离修正半径
+    for (const Plane& plane : planes) {
+        radius = std::min(radius, plane.normal.x * center.x + plane.normal.y * center.y
+                                      + plane.normal.z * center.z + static_cast<double>(plane.d()));
+    }
+    return radius > 1e-6 * scale;
+}
+
+// ===== 3D Quickhull =====
+
+struct HullFace {
+    std::uint32_t v[3] = {0, 0, 0};
+    std::int32_t adj[3] = {-1, -1, -1}; ///< adj[k] 为边 v[k] -> v[(k + 1) % 3] 另一侧的面
+    V3 normal;                          ///< 单位外法向量
+    double offset = 0.0;                ///< normal·p = offset
+    std::vector<std::uint32_t> outside; ///< 位于该面外侧、尚未处理的点
+    bool alive = true;
+    std::uint32_t stamp = 0;
+};
+
+class Quickhull {
+public:
+    Quickhull(const std::vector<V3>& points, double epsilon) : points_(points), epsilon_(epsilon) {}
+
+    // 点集退化（共面）时返回 false
+    bool build();
+
+    std::vector<HullFace> faces;
+
+private:
+    double distance(const HullFace& face, std::uint32_t p) const { return dot(face.normal, points_[p]) - face.offset; }
+    std::int32_t make_face(std::uint32_t a, std::uint32_t b, std::uint32_t c);
+    void assign(const std::vector<std::uint32_t>& candidates, const std::vector<std::int32_t>& targets);
+
+    const std::vector<V3>& points_;
+    double epsilon_;
+};
+
+std::int32_t Quickhull::make_face(std::uint32_t a, std::uint32_t b, std::uint32_t c) {
+    HullFace face;
+    face.v[0] = a;
+    face.v[1] = b;
+    face.v[2] = c;
+    const V3 n = cross(sub(points_[b], points_[a]), sub(points_[c], points_[a]));
+    const double length = std::sqrt(dot(n, n));
+    if (length > 0.0) {
+        face.normal = {n.x / length, n.y / length, n.z / length};
+    }
+    face.offset = dot(face.normal, points_[a]);
+    faces.push_back(std::move(face));
+    return static_cast<std::int32_t>(faces.size() - 1);
+}
+
+// 每个点归入离它最远的可见面，不在任何面外侧的点已在凸包内，直接丢弃
+void Quickhull::assign(const std::vector<std::uint32_t>& candidates, const std::vector<std::int32_t>& targets) {
+    for (std::uint32_t p : candidates) {
+        std::int32_t best = -1;
+        double best_distance = epsilon_;
+        for (std::int32_t f : targets) {
+            const double d = distance(faces[f], p);
+            if (d > best_distance) {
+                best_distance = d;
+                best = f;
+            }
+        }
+        if (best >= 0) {
+            faces[best].outside.push_back(p);
+        }
+    }
+}
+
+bool Quickhull::build() {
+    const std::size_t n = points_.size();
+    if (n < 4) {
+        return false;
+    }
+
+    // 初始四面体：坐标极值点中最远的两点，离其连线最远的点，离三点平面最远的点
+    std::uint32_t extremes[6] = {0, 0, 0, 0, 0, 0};
+    for (std::uint32_t i = 1; i < n; ++i) {
+        const V3& p = points_[i];
+        if (p.x < points_[extremes[0]].x) extremes[0] = i;
+        if (p.x > points_[extremes[1]].x) extremes[1] = i;
+        if (p.y < points_[extremes[2]].y) extremes[2] = i;
+        if (p.y > points_[extremes[3]].y) extremes[3] = i;
+        if (p.z < points_[extremes[4]].z) extremes[4] = i;
+        if (p.z > points_[extremes[5]].z) extremes[5] = i;
+    }
+    std::uint32_t a = extremes[0], b = extremes[1];
+    double best = -1.0;
+    for (int i = 0; i < 6; ++i) {
+        for (int j = i + 1; j < 6; ++j) {
+            const V3 d = sub(points_[extremes[i]], points_[extremes[j]]);
+            if (dot(d, d) > best) {
+                best = dot(d, d);
+                a = extremes[i];
+                b = extremes[j];
+            }
+        }
+    }
+    const V3 ab = sub(points_[b], points_[a]);
+    std::uint32_t c = a;
+    best = 0.0;
+    for (std::uint32_t i = 0; i < n; ++i) {
+        const V3 q = cross(ab, sub(points_[i], points_[a]));
+        if (dot(q, q) > best) {
+            best = dot(q, q);
+            c = i;
+        }
+    }
+    const V3 normal = cross(ab, sub(points_[c], points_[a]));
+    const double normal_length = std::sqrt(dot(normal, normal));
+    if (!(normal_length > epsilon_ * std::sqrt(dot(ab, ab)))) {
+        return false;
+    }
+    std::uint32_t d = a;
+    best = 0.0;
+    for (std::uint32_t i = 0; i < n; ++i) {
+        const double h = std::abs(dot(normal, sub(points_[i], points_[a]))) / normal_length;
+        if (h > best) {
+            best = h;
+            d = i;
+        }
+    }
+    if (!(best > epsilon_)) {
+        return false;
+    }
+
+    // 让 d 位于面 abc 的背面，四个面都朝外
+    if (dot(normal, sub(points_[d], points_[a])) > 0.0) {
+        std::swap(b, c);
+    }
+    const std::int32_t f0 = make_face(a, b, c);
+    const std::int32_t f1 = make_face(a, d, b);
+    const std::int32_t f2 = make_face(b, d, c);
+    const std::int32_t f3 = make_face(c, d, a);
+    const std::int32_t initial[4] = {f0, f1, f2, f3};
+    for (std::int32_t f : initial) {
+        for (int k = 0; k < 3; ++k) {
+            const std::uint32_t u = faces[f].v[k], w = faces[f].v[(k + 1) % 3];
+            for (std::int32_t g : initial) {
+                for (int m = 0; m < 3; ++m) {
+                    if (faces[g].v[m] == w && faces[g].v[(m + 1) % 3] == u) {
+                        faces[f].adj[k] = g;
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<std::uint32_t> rest;
+    rest.reserve(n);
+    for (std::uint32_t i = 0; i < n; ++i) {
+        if (i != a && i != b && i != c && i != d) {
+            rest.push_back(i);
+        }
+    }
+    assign(rest, {f0, f1, f2, f3});
+
+    std::vector<std::int32_t> pending(initial, initial + 4);
+    std::vector<std::int32_t> visible;
+    std::vector<std::int32_t> created;
+    std::vector<std::pair<std::uint32_t, std::int32_t>> by_start, by_end;
+    std::vector<std::uint32_t> orphans;
+    struct HorizonEdge {
+        std::uint32_t from, to;
+        std::int32_t neighbor;
+    };
+    std::vector<HorizonEdge> horizon;
+    std::uint32_t stamp = 0;
+
+    while (!pending.empty()) {
+        const std::int32_t seed = pending.back();
+        pending.pop_back();
+        if (!faces[seed].alive || faces[seed].outside.empty()) {
+            continue;
+        }
+
+        // 选离该面最远的外侧点作为新顶点
+        std::uint32_t eye = faces[seed].outside.front();
+        double eye_distance = distance(faces[seed], eye);
+        for (std::uint32_t p : faces[seed].outside) {
+            const double h = distance(faces[seed], p);
+            if (h > eye_distance) {
+                eye_distance = h;
+                eye = p;
+            }
+        }
+
+        // 从种子面出发广度优先找出所有可见面，同时记录地平线边
+        ++stamp;
+        visible.assign(1, seed);
+        faces[seed].stamp = stamp;
+        created.clear();
+        by_start.clear();
+        by_end.clear();
+        horizon.clear();
+        for (std::size_t k = 0; k < visible.size(); ++k) {
+            const std::int32_t f = visible[k];
+            for (int e = 0; e < 3; ++e) {
+                const std::int32_t g = faces[f].adj[e];
+                if (faces[g].stamp == stamp) {
+                    continue;
+                }
+                if (distance(faces[g], eye) > epsilon_) {
+                    faces[g].stamp = stamp;
+                    visible.push_back(g);
+                } else {
+                    horizon.push_back({faces[f].v[e], faces[f].v[(e + 1) % 3], g});
+                }
+            }
+        }
+
+        // 地平线边与新顶点组成新面：边 0 接旧的不可见面，边 1、2 接相邻的新面
+        for (const HorizonEdge& edge : horizon) {
+            const std::int32_t f = make_face(edge.from, edge.to, eye);
+            faces[f].adj[0] = edge.neighbor;
+            for (int m = 0; m < 3; ++m) {
+                if (faces[edge.neighbor].v[m] == edge.to && faces[edge.neighbor].v[(m + 1) % 3] == edge.from) {
+                    faces[edge.neighbor].adj[m] = f;
+                }
+            }
+            created.push_back(f);
+            by_start.emplace_back(edge.from, f);
+            by_end.emplace_back(edge.to, f);
+        }
+        std::sort(by_start.begin(), by_start.end());
+        std::sort(by_end.begin(), by_end.end());
+        const auto find = [](const std::vector<std::pair<std::uint32_t, std::int32_t>>& table, std::uint32_t key) {
+            const auto it = std::lower_bound(table.begin(), table.end(), std::make_pair(key, std::int32_t{-1}));
+            return it != table.end() && it->first == key ? it->second : std::int32_t{-1};
+        };
+        for (std::int32_t f : created) {
+            // 边 to -> eye 的另一侧是从 to 出发的新面，边 eye -> from 的另一侧是终止于 from 的新面
+            faces[f].adj[1] = find(by_start, faces[f].v[1]);
+            faces[f].adj[2] = find(by_end, faces[f].v[0]);
+        }
+
+        orphans.clear();
+        for (std::int32_t f : visible) {
+            for (std::uint32_t p : faces[f].outside) {
+                if (p != eye) {
+                    orphans.push_back(p);
+                }
+            }
+            faces[f].alive = false;
+            faces[f].outside.clear();
+            faces[f].outside.shrink_to_fit();
+        }
+        assign(orphans, created);
+        for (std::int32_t f : created) {
+            if (!faces[f].outside.empty()) {
+                pending.push_back(f);
+            }
+        }
+    }
+    return true;
+}
+
+// 并查集：合并对偶凸包上对应同一个多面体顶点的面
+std::uint32_t find_root(std::vector<std::uint32_t>& parent, std::uint32_t x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+} // namespace
+
+std::optional<Sphere> inscribed_sphere(const std::vector<Plane>& planes) {
+    if (planes.empty()) {
+        return std::nullopt;
+    }
+    V3 center;
+    double radius = 0.0;
+    if (!chebyshev_center(planes, center, radius)) {
+        return std::nullopt;
+    }
+    return Sphere(Point(static_cast<float>(center.x), static_cast<float>(center.y), static_cast<float>(center.z)),
+                  static_cast<float>(radius));
+}
+
+std::optional<ConvexPolyhedron> halfspace_intersection(const std::vector<Plane>& planes) {
+    if (planes.size() < 4) {
+        return std::nullopt;
+    }
+    V3 center;
+    double radius = 0.0;
+    if (!chebyshev_center(planes, center, radius)) {
+        return std::nullopt;
+    }
+
+    // 平移到内部点后，半空间 n·y + h >= 0（h > 0）对偶为点 -n / h
+    std::vector<V3> dual(planes.size());
+    double extent = 0.0;
+    for (std::size_t i = 0; i < planes.size(); ++i) {
+        const Plane& plane = planes[i];
+        const V3 n{plane.normal.x, plane.normal.y, plane.normal.z};
+        const double h = dot(n, center) + plane.d();
+        dual[i] = {-n.x / h, -n.y / h, -n.z / h};
+        extent = std::max({extent, std::abs(dual[i].x), std::abs(dual[i].y), std::abs(dual[i].z)});
+    }
+
+    Quickhull hull(dual, 1e-9 * extent);
+    if (!hull.build()) {
+        return std::nullopt;
+    }
+
+    // 原点必须严格在对偶凸包内部，否则交集无界
+    std::vector<std::int32_t> alive;
+    for (std::size_t f = 0; f < hull.faces.size(); ++f) {
+        if (hull.faces[f].alive) {
+            if (!(hull.faces[f].offset > 1e-9 * extent)) {
+                return std::nullopt;
+            }
+            alive.push_back(static_cast<std::int32_t>(f));
+        }
+    }
+
+    // 每个对偶面 q·p = offset 对应平移后的多面体顶点 q / offset，直接在双精度下求出；
+    // 相邻面的顶点重合（多于三个平面交于一点）时合并为一个顶点
+    std::vector<Point> corner(hull.faces.size());
+    double scale = std::sqrt(dot(center, center)) + radius;
+    for (std::int32_t f : alive) {
+        const HullFace& face = hull.faces[f];
+        corner[f] = Point(static_cast<float>(center.x + face.normal.x / face.offset),
+                          static_cast<float>(center.y + face.normal.y / face.offset),
+                          static_cast<float>(center.z + face.normal.z / face.offset));
+        scale = std::max(scale, corner[f].magnitude());
+    }
+    std::vector<std::uint32_t> parent(hull.faces.size());
+    std::iota(parent.begin(), parent.end(), 0u);
+    const double weld = 1e-5 * scale;
+    for (std::int32_t f : alive) {
+        for (std::int32_t g : hull.faces[f].adj) {
+            if ((corner[f] - corner[g]).magnitude() <= weld) {
+                parent[find_root(parent, static_cast<std::uint32_t>(f))] = find_root(parent, static_cast<std::uint32_t>(g));
+            }
+        }
+    }
+
+    ConvexPolyhedron polyhedron;
+    constexpr std::uint32_t kUnassigned = 0xFFFFFFFFu;
+    std::vector<std::uint32_t> vertex_of(hull.faces.size(), kUnassigned);
+    std::vector<std::int32_t> start(planes.size(), -1);
+    for (std::int32_t f : alive) {
+        for (std::uint32_t v : hull.faces[f].v) {
+            if (start[v] < 0) {
+                start[v] = f;
+            }
+        }
+    }
+
+    // 绕每个对偶顶点旋转一周，依次经过的对偶面就是多面体对应面的顶点
+    std::vector<std::uint32_t> loop;
+    for (std::size_t p = 0; p < planes.size(); ++p) {
+        if (start[p] < 0) {
+            continue;
+        }
+        loop.clear();
+        std::int32_t f = start[p];
+        do {
+            const std::uint32_t root = find_root(parent, static_cast<std::uint32_t>(f));
+            if (vertex_of[root] == kUnassigned) {
+                vertex_of[root] = static_cast<std::uint32_t>(polyhedron.vertices.size());
+                polyhedron.vertices.push_back(corner[root]);
+            }
+            if (loop.empty() || loop.back() != vertex_of[root]) {
+                loop.push_back(vertex_of[root]);
+            }
+            const HullFace& face = hull.faces[f];
+            const int k = face.v[0] == p ? 0 : face.v[1] == p ? 1 : 2;
+            f = face.adj[k];
+        } while (f != start[p]);
+        if (loop.size() > 1 && loop.back() == loop.front()) {
+            loop.pop_back();
+        }
+        if (loop.size() < 3) {
+            continue;
+        }
+        // 绕对偶顶点的旋转方向与多面体面从外部看的方向相反
+        polyhedron.face_indices.insert(polyhedron.face_indices.end(), loop.rbegin(), loop.rend());
+        polyhedron.face_offsets.push_back(polyhedron.face_indices.size());
+        polyhedron.face_planes.push_back(static_cast<std::uint32_t>(p));
+    }
+    return polyhedron;
+}
+
+} // namespace utils
+} // namespace geometry
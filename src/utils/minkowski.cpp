@@ -0,0 +1,270 @@
+#include "utils/minkowski.h"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+inline double cross_2d(const Point& o, const Point& a, const Point& b) {
+    return (static_cast<double>(a.x) - o.x) * (static_cast<double>(b.y) - o.y)
+         - (static_cast<double>(a.y) - o.y) * (static_cast<double>(b.x) - o.x);
+}
+
+double signed_area_2d(const Point* p, std::size_t n) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const Point& a = p[i];
+        const Point& b = p[(i + 1) % n];
+        sum += static_cast<double>(a.x) * b.y - static_cast<double>(b.x) * a.y;
+    }
+    return sum * 0.5;
+}
+
+// 按逆时针方向、从最低点开始遍历凸多边形的顶点
+struct ConvexLoop {
+    const Point* points;
+    std::size_t n;
+    std::size_t start;
+    std::size_t step;
+
+    ConvexLoop(const Point* p, std::size_t count) : points(p), n(count), start(0), step(1) {
+        for (std::size_t i = 1; i < n; ++i) {
+            if (p[i].y < p[start].y || (p[i].y == p[start].y && p[i].x < p[start].x)) {
+                start = i;
+            }
+        }
+        if (signed_area_2d(p, n) < 0.0) {
+            step = n - 1;
+        }
+    }
+
+    const Point& operator[](std::size_t i) const {
+        return points[(start + (i % n) * step) % n];
+    }
+};
+
+// 旋转边合并：按极角顺序依次走过两个多边形的边
+void append_convex_sum(const Point* a, std::size_t n, const Point* b, std::size_t m,
+                       std::vector<Point>& dst) {
+    if (n == 0 || m == 0) {
+        return;
+    }
+    const ConvexLoop la(a, n);
+    const ConvexLoop lb(b, m);
+
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < n || j < m) {
+        dst.push_back(la[i] + lb[j]);
+        const Point ea = la[i + 1] - la[i];
+        const Point eb = lb[j + 1] - lb[j];
+        const double cross = static_cast<double>(ea.x) * eb.y - static_cast<double>(ea.y) * eb.x;
+        if (j >= m || (i < n && cross > 0.0)) {
+            ++i;
+        } else if (i >= n || cross < 0.0) {
+            ++j;
+        } else {
+            ++i;
+            ++j;
+        }
+    }
+}
+
+bool point_in_triangle(const Point& p, const Point& a, const Point& b, const Point& c) {
+    return cross_2d(a, b, p) >= 0.0 && cross_2d(b, c, p) >= 0.0 && cross_2d(c, a, p) >= 0.0;
+}
+
+} // namespace
+
+void minkowski_sum_convex(const Polygon& a, const Polygon& b, Polygon& out) {
+    out.vertices.clear();
+    out.vertices.reserve(a.vertices.size() + b.vertices.size());
+    append_convex_sum(a.vertices.data(), a.vertices.size(),
+                      b.vertices.data(), b.vertices.size(), out.vertices);
+}
+
+Polygon minkowski_sum_convex(const Polygon& a, const Polygon& b) {
+    Polygon out;
+    minkowski_sum_convex(a, b, out);
+    return out;
+}
+
+std::vector<Polygon> convex_decomposition(const Polygon& polygon) {
+    std::vector<Polygon> result;
+    const std::size_t n = polygon.vertices.size();
+    if (n == 0) {
+        return result;
+    }
+
+    std::vector<Point> pts = polygon.vertices;
+    if (signed_area_2d(pts.data(), n) < 0.0) {
+        std::reverse(pts.begin(), pts.end());
+    }
+    if (n < 4 || Polygon(pts).is_convex()) {
+        result.emplace_back(pts);
+        return result;
+    }
+
+    // 耳切法三角化
+    std::vector<std::size_t> prev(n), next(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        prev[i] = (i + n - 1) % n;
+        next[i] = (i + 1) % n;
+    }
+
+    const auto is_ear = [&](std::size_t i) {
+        const std::size_t a = prev[i], c = next[i];
+        if (cross_2d(pts[a], pts[i], pts[c]) <= 0.0) {
+            return false;
+        }
+        for (std::size_t j = next[c]; j != a; j = next[j]) {
+            const Point& p = pts[j];
+            if (p == pts[a] || p == pts[i] || p == pts[c]) {
+                continue;
+            }
+            if (point_in_triangle(p, pts[a], pts[i], pts[c])) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::vector<std::vector<std::size_t>> loops;
+    loops.reserve(n - 2);
+    std::size_t remaining = n;
+    std::size_t current = 0;
+    while (remaining > 3) {
+        std::size_t ear = n;
+        std::size_t candidate = current;
+        for (std::size_t k = 0; k < remaining; ++k, candidate = next[candidate]) {
+            if (is_ear(candidate)) {
+                ear = candidate;
+                break;
+            }
+        }
+        if (ear == n) {
+            // 退化输入（共线或自交）：强制切掉当前顶点以保证前进
+            ear = current;
+        }
+        loops.push_back({prev[ear], ear, next[ear]});
+        next[prev[ear]] = next[ear];
+        prev[next[ear]] = prev[ear];
+        current = next[ear];
+        --remaining;
+    }
+    loops.push_back({prev[current], current, next[current]});
+
+    // Hertel-Mehlhorn：在不破坏凸性的前提下删除对角线
+    const auto key = [n](std::size_t u, std::size_t v) { return u * n + v; };
+    std::unordered_map<std::size_t, std::size_t> edge_owner;
+    for (std::size_t t = 0; t < loops.size(); ++t) {
+        for (std::size_t k = 0; k < 3; ++k) {
+            const std::size_t u = loops[t][k], v = loops[t][(k + 1) % 3];
+            if (v != (u + 1) % n) {
+                edge_owner[key(u, v)] = t;
+            }
+        }
+    }
+
+    std::vector<std::size_t> parent(loops.size());
+    for (std::size_t t = 0; t < parent.size(); ++t) {
+        parent[t] = t;
+    }
+    const auto find = [&parent](std::size_t t) {
+        while (parent[t] != t) {
+            parent[t] = parent[parent[t]];
+            t = parent[t];
+        }
+        return t;
+    };
+
+    const auto rotate_to = [](std::vector<std::size_t>& loop, std::size_t first) {
+        const auto it = std::find(loop.begin(), loop.end(), first);
+        std::rotate(loop.begin(), it, loop.end());
+    };
+
+    const std::vector<std::vector<std::size_t>> triangles = loops;
+    for (std::size_t t = 0; t < triangles.size(); ++t) {
+        for (std::size_t k = 0; k < 3; ++k) {
+            const std::size_t u = triangles[t][k], v = triangles[t][(k + 1) % 3];
+            if (v == (u + 1) % n || u > v) {
+                continue;
+            }
+            const auto it = edge_owner.find(key(v, u));
+            if (it == edge_owner.end()) {
+                continue;
+            }
+            const std::size_t r1 = find(t);
+            const std::size_t r2 = find(it->second);
+            if (r1 == r2) {
+                continue;
+            }
+
+            // r1 含有 u->v，r2 含有 v->u；合并后检查 u、v 两处的凸性
+            std::vector<std::size_t> l1 = loops[r1];
+            std::vector<std::size_t> l2 = loops[r2];
+            rotate_to(l1, v);
+            rotate_to(l2, u);
+            if (l1.back() != u || l2.back() != v) {
+                continue;
+            }
+            const bool convex_u = cross_2d(pts[l1[l1.size() - 2]], pts[u], pts[l2[1]]) >= 0.0;
+            const bool convex_v = cross_2d(pts[l2[l2.size() - 2]], pts[v], pts[l1[1]]) >= 0.0;
+            if (!convex_u || !convex_v) {
+                continue;
+            }
+
+            l1.insert(l1.end(), l2.begin() + 1, l2.end() - 1);
+            loops[r1] = std::move(l1);
+            loops[r2].clear();
+            parent[r2] = r1;
+        }
+    }
+
+    for (std::size_t t = 0; t < loops.size(); ++t) {
+        if (find(t) != t || loops[t].empty()) {
+            continue;
+        }
+        Polygon piece;
+        piece.vertices.reserve(loops[t].size());
+        for (std::size_t index : loops[t]) {
+            piece.add_vertex(pts[index]);
+        }
+        result.push_back(std::move(piece));
+    }
+    return result;
+}
+
+void minkowski_sum(const Polygon& a, const Polygon& b, PolygonBuffer& out) {
+    const bool a_convex = a.vertices.size() < 4 || a.is_convex();
+    const bool b_convex = b.vertices.size() < 4 || b.is_convex();
+    if (a_convex && b_convex) {
+        out.clear();
+        append_convex_sum(a.vertices.data(), a.vertices.size(),
+                          b.vertices.data(), b.vertices.size(), out.vertices);
+        out.close_polygon();
+        return;
+    }
+
+    const std::vector<Polygon> a_parts = a_convex ? std::vector<Polygon>{a} : convex_decomposition(a);
+    const std::vector<Polygon> b_parts = b_convex ? std::vector<Polygon>{b} : convex_decomposition(b);
+    minkowski_sum(a_parts, b_parts, out);
+}
+
+void minkowski_sum(const std::vector<Polygon>& a_parts, const std::vector<Polygon>& b_parts,
+                   PolygonBuffer& out) {
+    out.clear();
+    for (const auto& pa : a_parts) {
+        for (const auto& pb : b_parts) {
+            append_convex_sum(pa.vertices.data(), pa.vertices.size(),
+                              pb.vertices.data(), pb.vertices.size(), out.vertices);
+            out.close_polygon();
+        }
+    }
+}
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,314 @@
+#include "utils/offset.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <cmath>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+struct V2 {
+    double x = 0.0, y = 0.0;
+};
+
+inline V2 operator+(const V2& a, const V2& b) { return {a.x + b.x, a.y + b.y}; }
+inline V2 operator-(const V2& a, const V2& b) { return {a.x - b.x, a.y - b.y}; }
+inline V2 operator*(const V2& a, double s) { return {a.x * s, a.y * s}; }
+inline double cross(const V2& a, const V2& b) { return a.x * b.y - a.y * b.x; }
+inline double length(const V2& a) { return std::hypot(a.x, a.y); }
+
+double signed_area(const std::vector<V2>& pts) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < pts.size(); ++i) {
+        sum += cross(pts[i], pts[(i + 1) % pts.size()]);
+    }
+    return sum * 0.5;
+}
+
+// 沿法向量偏移每条边，并在顶点处按连接方式补齐
+std::vector<V2> raw_offset(const Polygon& polygon, double delta, JoinType join,
+                           double miter_limit, double arc_tolerance) {
+    const std::vector<Line> edges = polygon.edges();
+    const std::size_t n = edges.size();
+
+    std::vector<V2> dirs(n), normals(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const Point d = edges[i].direction();
+        dirs[i] = {d.x, d.y};
+        normals[i] = {d.y, -d.x};
+    }
+
+    const double abs_delta = std::abs(delta);
+    const double tolerance = std::clamp(arc_tolerance > 0.0 ? arc_tolerance : abs_delta * 0.005,
+                                        abs_delta * 1e-6, abs_delta);
+    const double step_angle = 2.0 * std::acos(1.0 - tolerance / abs_delta);
+    const double miter_bound = 2.0 / std::max(miter_limit * miter_limit, 1.0);
+
+    std::vector<V2> out;
+    out.reserve(n * 3);
+    for (std::size_t i = 0; i < n; ++i) {
+        const V2 v{edges[i].start.x, edges[i].start.y};
+        const std::size_t k = (i + n - 1) % n;
+        const V2& n0 = normals[k];
+        const V2& n1 = normals[i];
+        const double sin_a = cross(n0, n1);
+        const double cos_a = n0.x * n1.x + n0.y * n1.y;
+
+        if (cos_a > 0.0 && std::abs(sin_a) < 1e-9) {
+            // 共线顶点
+            out.push_back(v + n1 * delta);
+            continue;
+        }
+
+        if (sin_a * delta < 0.0 && cos_a > -0.999999) {
+            // 凹角：经过原顶点连接两条偏移边，产生的反向小环稍后清除
+            out.push_back(v + n0 * delta);
+            out.push_back(v);
+            out.push_back(v + n1 * delta);
+            continue;
+        }
+
+        JoinType kind = join;
+        if (kind == JoinType::Miter && 1.0 + cos_a < miter_bound) {
+            kind = JoinType::Square;
+        }
+
+        switch (kind) {
+        case JoinType::Miter:
+            out.push_back(v + (n0 + n1) * (delta / (1.0 + cos_a)));
+            break;
+        case JoinType::Square: {
+            // 在角平分线方向距离 |delta| 处截平
+            const double dx = std::tan(std::atan2(sin_a, cos_a) / 4.0);
+            out.push_back({v.x + delta * (n0.x - n0.y * dx), v.y + delta * (n0.y + n0.x * dx)});
+            out.push_back({v.x + delta * (n1.x + n1.y * dx), v.y + delta * (n1.y - n1.x * dx)});
+            break;
+        }
+        case JoinType::Round: {
+            const double angle = std::atan2(sin_a, cos_a);
+            const std::size_t steps = std::max<std::size_t>(
+                1, static_cast<std::size_t>(std::ceil(std::abs(angle) / step_angle)));
+            for (std::size_t s = 0; s <= steps; ++s) {
+                const double theta = angle * static_cast<double>(s) / static_cast<double>(steps);
+                const double c = std::cos(theta), sn = std::sin(theta);
+                const V2 rotated{n0.x * c - n0.y * sn, n0.x * sn + n0.y * c};
+                out.push_back(v + rotated * delta);
+            }
+            break;
+        }
+        }
+    }
+    return out;
+}
+
+// 射线绕数（Sunday 算法）
+int winding_number(const std::vector<V2>& curve, const V2& p) {
+    int wn = 0;
+    const std::size_t m = curve.size();
+    for (std::size_t i = 0; i < m; ++i) {
+        const V2& a = curve[i];
+        const V2& b = curve[(i + 1) % m];
+        const double side = cross(b - a, p - a);
+        if (a.y <= p.y) {
+            if (b.y > p.y && side > 0.0) {
+                ++wn;
+            }
+        } else if (b.y <= p.y && side < 0.0) {
+            --wn;
+        }
+    }
+    return wn;
+}
+
+constexpr double kParamEpsilon = 1e-9;
+
+struct Crossing {
+    V2 point;
+    std::size_t node[2] = {0, 0};
+};
+
+// 在自交点处把闭合曲线拆成若干简单环，只保留正绕数区域的边界
+std::vector<std::vector<V2>> remove_self_intersections(const std::vector<V2>& curve) {
+    const std::size_t m = curve.size();
+
+    // 按 x 最小值排序的扫描线粗筛
+    std::vector<std::size_t> order(m);
+    for (std::size_t i = 0; i < m; ++i) {
+        order[i] = i;
+    }
+    const auto min_x = [&](std::size_t i) { return std::min(curve[i].x, curve[(i + 1) % m].x); };
+    const auto max_x = [&](std::size_t i) { return std::max(curve[i].x, curve[(i + 1) % m].x); };
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return min_x(a) < min_x(b); });
+
+    std::vector<Crossing> crossings;
+    std::vector<std::vector<std::pair<double, std::size_t>>> on_segment(m);
+    std::vector<std::size_t> active;
+    for (std::size_t i : order) {
+        const double x0 = min_x(i);
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [&](std::size_t a) { return max_x(a) < x0; }),
+                     active.end());
+
+        const V2& p = curve[i];
+        const V2 r = curve[(i + 1) % m] - p;
+        const double y_lo = std::min(p.y, p.y + r.y), y_hi = std::max(p.y, p.y + r.y);
+        for (std::size_t j : active) {
+            if (j == (i + 1) % m || i == (j + 1) % m) {
+                continue;
+            }
+            const V2& q = curve[j];
+            const V2 s = curve[(j + 1) % m] - q;
+            if (std::max(q.y, q.y + s.y) < y_lo || std::min(q.y, q.y + s.y) > y_hi) {
+                continue;
+            }
+            const double denom = cross(r, s);
+            if (denom == 0.0) {
+                continue;
+            }
+            // 半开区间 [0, 1)：顶点落在另一条边上的情况只会被相邻两条边中的一条记录
+            double t = cross(q - p, s) / denom;
+            double u = cross(q - p, r) / denom;
+            if (t < -kParamEpsilon || t >= 1.0 - kParamEpsilon || u < -kParamEpsilon || u >= 1.0 - kParamEpsilon) {
+                continue;
+            }
+            t = std::max(t, 0.0);
+            u = std::max(u, 0.0);
+            const std::size_t c = crossings.size();
+            crossings.push_back({p + r * t, {0, 0}});
+            on_segment[i].emplace_back(t, c * 2);
+            on_segment[j].emplace_back(u, c * 2 + 1);
+        }
+        active.push_back(i);
+    }
+
+    if (crossings.empty()) {
+        return {curve};
+    }
+
+    // 建立节点序列：原顶点之后依次插入该边上的交点
+    std::vector<V2> nodes;
+    nodes.reserve(m + crossings.size() * 2);
+    for (std::size_t k = 0; k < m; ++k) {
+        nodes.push_back(curve[k]);
+        auto& list = on_segment[k];
+        std::sort(list.begin(), list.end());
+        for (const auto& entry : list) {
+            crossings[entry.second / 2].node[entry.second % 2] = nodes.size();
+            nodes.push_back(crossings[entry.second / 2].point);
+        }
+    }
+
+    // 在每个交点处交换两条路径的后继，得到互不交叉的环
+    const std::size_t count = nodes.size();
+    std::vector<std::size_t> next(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        next[i] = (i + 1) % count;
+    }
+    for (const auto& c : crossings) {
+        next[c.node[0]] = (c.node[1] + 1) % count;
+        next[c.node[1]] = (c.node[0] + 1) % count;
+    }
+
+    std::vector<std::vector<V2>> loops;
+    std::vector<bool> visited(count, false);
+    for (std::size_t start = 0; start < count; ++start) {
+        if (visited[start]) {
+            continue;
+        }
+        std::vector<V2> loop;
+        for (std::size_t i = start; !visited[i]; i = next[i]) {
+            visited[i] = true;
+            if (loop.empty() || loop.back().x != nodes[i].x || loop.back().y != nodes[i].y) {
+                loop.push_back(nodes[i]);
+            }
+        }
+        loops.push_back(std::move(loop));
+    }
+    return loops;
+}
+
+} // namespace
+
+std::vector<Polygon> offset_polygon(const Polygon& polygon, float delta, JoinType join,
+                                    float miter_limit, float arc_tolerance) {
+    std::vector<Polygon> result;
+
+    // 去掉重复的相邻顶点，保证 Line::direction 不会遇到零长度边
+    Polygon clean;
+    clean.vertices.reserve(polygon.vertices.size());
+    for (const auto& v : polygon.vertices) {
+        if (clean.vertices.empty() || clean.vertices.back().x != v.x || clean.vertices.back().y != v.y) {
+            clean.add_vertex(v);
+        }
+    }
+    while (clean.vertices.size() > 1 && clean.vertices.front().x == clean.vertices.back().x
+           && clean.vertices.front().y == clean.vertices.back().y) {
+        clean.vertices.pop_back();
+    }
+    if (clean.vertices.size() < 3 || clean.signed_area() == 0.0f) {
+        return result;
+    }
+    if (clean.signed_area() < 0.0f) {
+        std::reverse(clean.vertices.begin(), clean.vertices.end());
+    }
+    if (delta == 0.0f) {
+        result.push_back(clean);
+        return result;
+    }
+
+    const float z = clean.vertices.front().z;
+    const std::vector<V2> curve = raw_offset(clean, delta, join, miter_limit, arc_tolerance);
+
+    double extent = std::abs(static_cast<double>(delta));
+    for (const auto& p : curve) {
+        extent = std::max({extent, std::abs(p.x), std::abs(p.y)});
+    }
+    const double min_area = extent * extent * 1e-12;
+
+    for (const auto& loop : remove_self_intersections(curve)) {
+        if (loop.size() < 3 || std::abs(signed_area(loop)) <= min_area) {
+            continue;
+        }
+
+        // 在最长边左侧取样：区域边界的左侧绕数必须为1
+        std::size_t longest = 0;
+        double longest_len = 0.0;
+        for (std::size_t i = 0; i < loop.size(); ++i) {
+            const double len = length(loop[(i + 1) % loop.size()] - loop[i]);
+            if (len > longest_len) {
+                longest_len = len;
+                longest = i;
+            }
+        }
+        const V2 a = loop[longest];
+        const V2 e = loop[(longest + 1) % loop.size()] - a;
+        const V2 left{-e.y / longest_len, e.x / longest_len};
+        const V2 sample = a + e * 0.5 + left * (longest_len * 1e-4);
+        if (winding_number(curve, sample) != 1) {
+            continue;
+        }
+
+        Polygon piece;
+        piece.vertices.reserve(loop.size());
+        for (const auto& p : loop) {
+            piece.add_vertex(Point(static_cast<float>(p.x), static_cast<float>(p.y), z));
+        }
+        result.push_back(std::move(piece));
+    }
+    return result;
+}
+
+std::vector<std::vector<Polygon>> offset_polygons(const std::vector<Polygon>& polygons, float delta,
+                                                  JoinType join, float miter_limit, float arc_tolerance) {
+    std::vector<std::vector<Polygon>> results(polygons.size());
+    parallel_for(polygons.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            results[i] = offset_polygon(polygons[i], delta, join, miter_limit, arc_tolerance);
+        }
+    }, 16);
+    return results;
+}
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,367 @@
+#include "utils/predicates.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+std::atomic<PredicatePolicy> g_policy{PredicatePolicy::Exact};
+
+// ---- 无误差变换：x + y 精确等于 a op b ----
+
+inline void two_sum(double a, double b, double& x, double& y) noexcept {
+    x = a + b;
+    const double bvirt = x - a;
+    const double avirt = x - bvirt;
+    y = (a - avirt) + (b - bvirt);
+}
+
+inline void fast_two_sum(double a, double b, double& x, double& y) noexcept {
+    x = a + b;
+    y = b - (x - a);
+}
+
+inline void two_product(double a, double b, double& x, double& y) noexcept {
+    x = a * b;
+    y = std::fma(a, b, -x);
+}
+
+// ---- 展开式运算：分量互不重叠、按绝对值递增存放，并消去零分量 ----
+// 所有函数返回结果的分量数；h 必须有足够的容量
+
+// h = e + b，h 可以与 e 是同一数组
+int grow_expansion(const double* e, int elen, double b, double* h) noexcept {
+    double q = b;
+    int hlen = 0;
+    for (int i = 0; i < elen; ++i) {
+        double sum, tail;
+        two_sum(q, e[i], sum, tail);
+        q = sum;
+        if (tail != 0.0) {
+            h[hlen++] = tail;
+        }
+    }
+    if (q != 0.0 || hlen == 0) {
+        h[hlen++] = q;
+    }
+    return hlen;
+}
+
+// h = h + f（就地累加）
+int add_expansion(double* h, int hlen, const double* f, int flen) noexcept {
+    for (int i = 0; i < flen; ++i) {
+        hlen = grow_expansion(h, hlen, f[i], h);
+    }
+    return hlen;
+}
+
+// h = e * b
+int scale_expansion(const double* e, int elen, double b, double* h) noexcept {
+    double q, tail;
+    two_product(e[0], b, q, tail);
+    int hlen = 0;
+    if (tail != 0.0) {
+        h[hlen++] = tail;
+    }
+    for (int i = 1; i < elen; ++i) {
+        double product, product_tail, sum;
+        two_product(e[i], b, product, product_tail);
+        two_sum(q, product_tail, sum, tail);
+        if (tail != 0.0) {
+            h[hlen++] = tail;
+        }
+        fast_two_sum(product, sum, q, tail);
+        if (tail != 0.0) {
+            h[hlen++] = tail;
+        }
+    }
+    if (q != 0.0 || hlen == 0) {
+        h[hlen++] = q;
+    }
+    return hlen;
+}
+
+// h = e * f，h 的容量至少为 2 * elen * flen，scratch 的容量至少为 2 * elen
+int multiply_expansion(const double* e, int elen, const double* f, int flen, double* h, double* scratch) noexcept {
+    int hlen = scale_expansion(e, elen, f[0], h);
+    for (int i = 1; i < flen; ++i) {
+        const int slen = scale_expansion(e, elen, f[i], scratch);
+        hlen = add_expansion(h, hlen, scratch, slen);
+    }
+    return hlen;
+}
+
+void negate_expansion(double* e, int elen) noexcept {
+    for (int i = 0; i < elen; ++i) {
+        e[i] = -e[i];
+    }
+}
+
+// a - b 的精确值（最多 2 个分量；差值没有舍入时只有 1 个，后续乘法随之变便宜）
+int difference(double a, double b, double* h) noexcept {
+    double x, y;
+    two_sum(a, -b, x, y);
+    if (y == 0.0) {
+        h[0] = x;
+        return 1;
+    }
+    h[0] = y;
+    h[1] = x;
+    return 2;
+}
+
+/**
+ * 长度有上限的展开式；最高分量是整个和的近似值，其符号就是和的符号
+ */
+template <int N>
+struct Expansion {
+    double v[N];
+    int n = 0;
+
+    [[nodiscard]] double estimate() const noexcept { return v[n - 1]; }
+};
+
+// 精确计算 2x2 子式 ax * by - ay * bx，其中每项都是两个坐标差的乘积
+template <int N>
+void exact_minor(const Expansion<2>& ax, const Expansion<2>& ay, const Expansion<2>& bx, const Expansion<2>& by,
+                 Expansion<N>& result) noexcept {
+    static_assert(N >= 16, "minor needs 16 components");
+    double scratch[4];
+    double right[8];
+    result.n = multiply_expansion(ax.v, ax.n, by.v, by.n, result.v, scratch);
+    const int rlen = multiply_expansion(ay.v, ay.n, bx.v, bx.n, right, scratch);
+    negate_expansion(right, rlen);
+    result.n = add_expansion(result.v, result.n, right, rlen);
+}
+
+Expansion<2> exact_difference(double a, double b) noexcept {
+    Expansion<2> d;
+    d.n = difference(a, b, d.v);
+    return d;
+}
+
+double orient2d_exact(double ax, double ay, double bx, double by, double cx, double cy) noexcept {
+    const auto acx = exact_difference(ax, cx), acy = exact_difference(ay, cy);
+    const auto bcx = exact_difference(bx, cx), bcy = exact_difference(by, cy);
+    Expansion<16> det;
+    exact_minor(acx, acy, bcx, bcy, det);
+    return det.estimate();
+}
+
+double orient3d_exact(const Point& a, const Point& b, const Point& c, const Point& d) noexcept {
+    const auto adx = exact_difference(a.x, d.x), ady = exact_difference(a.y, d.y), adz = exact_difference(a.z, d.z);
+    const auto bdx = exact_difference(b.x, d.x), bdy = exact_difference(b.y, d.y), bdz = exact_difference(b.z, d.z);
+    const auto cdx = exact_difference(c.x, d.x), cdy = exact_difference(c.y, d.y), cdz = exact_difference(c.z, d.z);
+
+    Expansion<16> bc, ca, ab;
+    exact_minor(bdx, bdy, cdx, cdy, bc);
+    exact_minor(cdx, cdy, adx, ady, ca);
+    exact_minor(adx, ady, bdx, bdy, ab);
+
+    Expansion<192> det;
+    double term[64];
+    double scratch[32];
+    det.n = multiply_expansion(bc.v, bc.n, adz.v, adz.n, det.v, scratch);
+    int tlen = multiply_expansion(ca.v, ca.n, bdz.v, bdz.n, term, scratch);
+    det.n = add_expansion(det.v, det.n, term, tlen);
+    tlen = multiply_expansion(ab.v, ab.n, cdz.v, cdz.n, term, scratch);
+    det.n = add_expansion(det.v, det.n, term, tlen);
+    return det.estimate();
+}
+
+double incircle_exact(double ax, double ay, double bx, double by, double cx, double cy, double dx,
+                      double dy) noexcept {
+    const auto adx = exact_difference(ax, dx), ady = exact_difference(ay, dy);
+    const auto bdx = exact_difference(bx, dx), bdy = exact_difference(by, dy);
+    const auto cdx = exact_difference(cx, dx), cdy = exact_difference(cy, dy);
+
+    // lift = dx^2 + dy^2
+    const auto lift = [](const Expansion<2>& x, const Expansion<2>& y, Expansion<16>& out) {
+        double scratch[4];
+        double yy[8];
+        out.n = multiply_expansion(x.v, x.n, x.v, x.n, out.v, scratch);
+        const int ylen = multiply_expansion(y.v, y.n, y.v, y.n, yy, scratch);
+        out.n = add_expansion(out.v, out.n, yy, ylen);
+    };
+
+    Expansion<16> alift, blift, clift, bc, ca, ab;
+    lift(adx, ady, alift);
+    lift(bdx, bdy, blift);
+    lift(cdx, cdy, clift);
+    exact_minor(bdx, bdy, cdx, cdy, bc);
+    exact_minor(cdx, cdy, adx, ady, ca);
+    exact_minor(adx, ady, bdx, bdy, ab);
+
+    Expansion<1536> det;
+    double term[512];
+    double scratch[32];
+    det.n = multiply_expansion(bc.v, bc.n, alift.v, alift.n, det.v, scratch);
+    int tlen = multiply_expansion(ca.v, ca.n, blift.v, blift.n, term, scratch);
+    det.n = add_expansion(det.v, det.n, term, tlen);
+    tlen = multiply_expansion(ab.v, ab.n, clift.v, clift.n, term, scratch);
+    det.n = add_expansion(det.v, det.n, term, tlen);
+    return det.estimate();
+}
+
+// ---- 区间算术：每次运算后把端点向外移动至少一个 ulp，保证区间包含真实值 ----
+// |x| * 2^-52 不小于 x 的 ulp，且乘以 2 的幂是精确的。与误差界过滤一样不考虑乘积下溢；
+// 加减法在渐进下溢下是精确的，所以精确为 0 的结果不需要加宽（加宽会产生非规格化数，非常慢）
+
+constexpr double kUlpScale = 2.0 * detail::kEpsilon;
+
+struct Interval {
+    double lo, hi;
+};
+
+inline double down(double x) noexcept {
+    return x - std::abs(x) * kUlpScale;
+}
+
+inline double up(double x) noexcept {
+    return x + std::abs(x) * kUlpScale;
+}
+
+inline Interval point(double x) noexcept {
+    return {x, x};
+}
+
+inline Interval operator+(const Interval& a, const Interval& b) noexcept {
+    return {down(a.lo + b.lo), up(a.hi + b.hi)};
+}
+
+inline Interval operator-(const Interval& a, const Interval& b) noexcept {
+    return {down(a.lo - b.hi), up(a.hi - b.lo)};
+}
+
+inline Interval operator*(const Interval& a, const Interval& b) noexcept {
+    const double p1 = a.lo * b.lo, p2 = a.lo * b.hi, p3 = a.hi * b.lo, p4 = a.hi * b.hi;
+    return {down(std::min(std::min(p1, p2), std::min(p3, p4))), up(std::max(std::max(p1, p2), std::max(p3, p4)))};
+}
+
+inline Interval square(const Interval& a) noexcept {
+    if (a.lo >= 0.0) {
+        return {down(a.lo * a.lo), up(a.hi * a.hi)};
+    }
+    if (a.hi <= 0.0) {
+        return {down(a.hi * a.hi), up(a.lo * a.lo)};
+    }
+    const double m = std::max(-a.lo, a.hi);
+    return {0.0, up(m * m)};
+}
+
+// 区间确定了符号时返回 true，value 为区间中点
+inline bool certain(const Interval& det, double& value) noexcept {
+    if (det.lo > 0.0 || det.hi < 0.0) {
+        value = 0.5 * det.lo + 0.5 * det.hi;
+        return true;
+    }
+    return false;
+}
+
+// 过滤失败之后各阶段的计数；只在慢路径上累加
+std::atomic<std::uint64_t> g_interval_hits[detail::kCounterCount] = {};
+std::atomic<std::uint64_t> g_exact_evaluations[detail::kCounterCount] = {};
+
+inline void count(std::atomic<std::uint64_t>* counters, detail::Counter counter) noexcept {
+    if (detail::g_stats_enabled.load(std::memory_order_relaxed)) {
+        counters[counter].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+PredicateCounters snapshot(detail::Counter counter) noexcept {
+    PredicateCounters result;
+    result.filter_hits = detail::g_filter_hits[counter].load(std::memory_order_relaxed);
+    result.interval_hits = g_interval_hits[counter].load(std::memory_order_relaxed);
+    result.exact_evaluations = g_exact_evaluations[counter].load(std::memory_order_relaxed);
+    return result;
+}
+
+} // namespace
+
+namespace detail {
+
+double orient2d_adapt(double ax, double ay, double bx, double by, double cx, double cy) noexcept {
+    const Interval det = (point(ax) - point(cx)) * (point(by) - point(cy))
+                         - (point(ay) - point(cy)) * (point(bx) - point(cx));
+    double value;
+    if (certain(det, value)) {
+        count(g_interval_hits, kOrient2d);
+        return value;
+    }
+    count(g_exact_evaluations, kOrient2d);
+    return orient2d_exact(ax, ay, bx, by, cx, cy);
+}
+
+double orient3d_adapt(const Point& a, const Point& b, const Point& c, const Point& d) noexcept {
+    const Interval adx = point(a.x) - point(d.x), ady = point(a.y) - point(d.y), adz = point(a.z) - point(d.z);
+    const Interval bdx = point(b.x) - point(d.x), bdy = point(b.y) - point(d.y), bdz = point(b.z) - point(d.z);
+    const Interval cdx = point(c.x) - point(d.x), cdy = point(c.y) - point(d.y), cdz = point(c.z) - point(d.z);
+    const Interval det = adz * (bdx * cdy - cdx * bdy) + bdz * (cdx * ady - adx * cdy) + cdz * (adx * bdy - bdx * ady);
+    double value;
+    if (certain(det, value)) {
+        count(g_interval_hits, kOrient3d);
+        return value;
+    }
+    count(g_exact_evaluations, kOrient3d);
+    return orient3d_exact(a, b, c, d);
+}
+
+double incircle_adapt(double ax, double ay, double bx, double by, double cx, double cy, double dx,
+                      double dy) noexcept {
+    const Interval adx = point(ax) - point(dx), ady = point(ay) - point(dy);
+    const Interval bdx = point(bx) - point(dx), bdy = point(by) - point(dy);
+    const Interval cdx = point(cx) - point(dx), cdy = point(cy) - point(dy);
+    const Interval alift = square(adx) + square(ady);
+    const Interval blift = square(bdx) + square(bdy);
+    const Interval clift = square(cdx) + square(cdy);
+    const Interval det = alift * (bdx * cdy - cdx * bdy) + blift * (cdx * ady - adx * cdy)
+                         + clift * (adx * bdy - bdx * ady);
+    double value;
+    if (certain(det, value)) {
+        count(g_interval_hits, kIncircle);
+        return value;
+    }
+    count(g_exact_evaluations, kIncircle);
+    return incircle_exact(ax, ay, bx, by, cx, cy, dx, dy);
+}
+
+} // namespace detail
+
+void set_predicate_policy(PredicatePolicy policy) noexcept {
+    g_policy.store(policy, std::memory_order_relaxed);
+}
+
+PredicatePolicy predicate_policy() noexcept {
+    return g_policy.load(std::memory_order_relaxed);
+}
+
+void set_predicate_stats_enabled(bool enabled) noexcept {
+    detail::g_stats_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool predicate_stats_enabled() noexcept {
+    return detail::g_stats_enabled.load(std::memory_order_relaxed);
+}
+
+PredicateStats predicate_stats() noexcept {
+    PredicateStats stats;
+    stats.orient2d = snapshot(detail::kOrient2d);
+    stats.orient3d = snapshot(detail::kOrient3d);
+    stats.incircle = snapshot(detail::kIncircle);
+    return stats;
+}
+
+void reset_predicate_stats() noexcept {
+    for (int i = 0; i < detail::kCounterCount; ++i) {
+        detail::g_filter_hits[i].store(0, std::memory_order_relaxed);
+        g_interval_hits[i].store(0, std::memory_order_relaxed);
+        g_exact_evaluations[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace utils
+} // namespace geometry
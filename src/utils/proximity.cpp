@@ -0,0 +1,519 @@
+#include "utils/proximity.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+struct Vec3 {
+    double x = 0.0, y = 0.0, z = 0.0;
+};
+
+inline double distance_sq(const Vec3& a, const Vec3& b) {
+    const double dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+    return dx * dx + dy * dy + dz * dz;
+}
+
+std::vector<Vec3> to_vec3(const std::vector<Point>& points) {
+    std::vector<Vec3> pts;
+    pts.reserve(points.size());
+    for (const auto& p : points) {
+        pts.push_back({p.x, p.y, p.z});
+    }
+    return pts;
+}
+
+// 单元格坐标夹在 ±2^40 内，极端尺度下只会让候选集合变大，不影响正确性
+inline std::int64_t cell_coord(double value, double origin, double size) {
+    constexpr double kLimit = 1099511627776.0;
+    return static_cast<std::int64_t>(std::floor(std::clamp((value - origin) / size, -kLimit, kLimit)));
+}
+
+inline std::uint64_t cell_key(std::int64_t x, std::int64_t y, std::int64_t z) {
+    std::uint64_t h = static_cast<std::uint64_t>(x) * 0x9E3779B97F4A7C15ULL;
+    h ^= static_cast<std::uint64_t>(y) * 0xC2B2AE3D27D4EB4FULL + (h << 6) + (h >> 2);
+    h ^= static_cast<std::uint64_t>(z) * 0x165667B19E3779F9ULL + (h << 6) + (h >> 2);
+    return h;
+}
+
+constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+
+// 以当前最近距离为边长的哈希网格：开放寻址表记录每个单元格的链表头，
+// 用版本号代替清空，重建网格时不必重新分配或遍历整张表
+class PairGrid {
+public:
+    PairGrid(const std::vector<Vec3>& pts, const Vec3& origin)
+        : pts_(pts), origin_(origin), next_(pts.size(), kNone) {
+        std::size_t capacity = 16;
+        while (capacity < pts.size() * 2) {
+            capacity <<= 1;
+        }
+        slots_.resize(capacity);
+        mask_ = capacity - 1;
+    }
+
+    void reset(double size) {
+        size_ = size;
+        ++generation_;
+    }
+
+    void insert(std::size_t index) {
+        const Vec3& p = pts_[index];
+        Slot& slot = find(cell_key(cell_coord(p.x, origin_.x, size_), cell_coord(p.y, origin_.y, size_),
+                                   cell_coord(p.z, origin_.z, size_)));
+        if (slot.generation != generation_) {
+            slot.generation = generation_;
+            slot.head = kNone;
+        }
+        next_[index] = slot.head;
+        slot.head = index;
+    }
+
+    // 在相邻 27 个单元格中找离 p 最近的点（只可能比当前最近距离更近）
+    std::size_t nearest(const Vec3& p, double& best_sq) {
+        const std::int64_t cx = cell_coord(p.x, origin_.x, size_);
+        const std::int64_t cy = cell_coord(p.y, origin_.y, size_);
+        const std::int64_t cz = cell_coord(p.z, origin_.z, size_);
+        std::size_t best = kNone;
+        for (std::int64_t dx = -1; dx <= 1; ++dx) {
+            for (std::int64_t dy = -1; dy <= 1; ++dy) {
+                for (std::int64_t dz = -1; dz <= 1; ++dz) {
+                    const Slot& slot = find(cell_key(cx + dx, cy + dy, cz + dz));
+                    if (slot.generation != generation_) {
+                        continue;
+                    }
+                    for (std::size_t j = slot.head; j != kNone; j = next_[j]) {
+                        const double d = distance_sq(p, pts_[j]);
+                        if (d < best_sq) {
+                            best_sq = d;
+                            best = j;
+                        }
+                    }
+                }
+            }
+        }
+        return best;
+    }
+
+private:
+    struct Slot {
+        std::uint64_t key = 0;
+        std::uint64_t generation = 0;
+        std::size_t head = kNone;
+    };
+
+    // 返回 key 所在的槽位；不存在时返回第一个过期槽位（当前版本内表最多半满）
+    Slot& find(std::uint64_t key) {
+        for (std::size_t i = static_cast<std::size_t>(key >> 17) & mask_;; i = (i + 1) & mask_) {
+            Slot& slot = slots_[i];
+            if (slot.generation != generation_) {
+                slot.key = key;
+                return slot;
+            }
+            if (slot.key == key) {
+                return slot;
+            }
+        }
+    }
+
+    const std::vector<Vec3>& pts_;
+    Vec3 origin_;
+    double size_ = 1.0;
+    std::uint64_t generation_ = 1;
+    std::size_t mask_ = 0;
+    std::vector<std::size_t> next_;
+    std::vector<Slot> slots_;
+};
+
+ClosestPair make_pair_result(std::size_t a, std::size_t b, double dist_sq) {
+    return {std::min(a, b), std::max(a, b), static_cast<float>(std::sqrt(dist_sq))};
+}
+
+// 两线段方向夹角的正弦平方小于此值时按平行处理（夹角约小于 1e-6 弧度）
+constexpr double kParallel = 1e-12;
+constexpr std::size_t kClosestChunk = 1 << 12;
+
+inline Vec3 to_vec3(const Point& p) {
+    return {p.x, p.y, p.z};
+}
+
+inline Point to_point(const Vec3& v) {
+    return Point(static_cast<float>(v.x), static_cast<float>(v.y), static_cast<float>(v.z));
+}
+
+inline Vec3 sub(const Vec3& a, const Vec3& b) {
+    return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+inline double dot(const Vec3& a, const Vec3& b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+// p + s * d
+inline Vec3 along(const Vec3& p, const Vec3& d, double s) {
+    return {p.x + s * d.x, p.y + s * d.y, p.z + s * d.z};
+}
+
+inline double clamp01(double value) {
+    return std::clamp(value, 0.0, 1.0);
+}
+
+// Ericson《Real-Time Collision Detection》5.1.9：先求两直线的最近点，再依次把参数夹到 [0, 1]
+SegmentClosestPoints closest_on_segments(const Line& first, const Line& second) noexcept {
+    const Vec3 p1 = to_vec3(first.start), p2 = to_vec3(second.start);
+    const Vec3 d1 = sub(to_vec3(first.end), p1), d2 = sub(to_vec3(second.end), p2), r = sub(p1, p2);
+    const double a = dot(d1, d1), e = dot(d2, d2), f = dot(d2, r);
+    double s = 0.0, t = 0.0;
+    if (a == 0.0 && e != 0.0) {
+        t = clamp01(f / e);
+    } else if (a != 0.0) {
+        const double c = dot(d1, r);
+        if (e == 0.0) {
+            s = clamp01(-c / a);
+        } else {
+            const double b = dot(d1, d2);
+            const double denom = a * e - b * b;
+            // 平行时任取 s = 0，下面求 t 并夹取后仍能得到一组最近点
+            s = denom > kParallel * a * e ? clamp01((b * f - c * e) / denom) : 0.0;
+            t = (b * s + f) / e;
+            if (t < 0.0) {
+                t = 0.0;
+                s = clamp01(-c / a);
+            } else if (t > 1.0) {
+                t = 1.0;
+                s = clamp01((b - c) / a);
+            }
+        }
+    }
+    const Vec3 q1 = along(p1, d1, s), q2 = along(p2, d2, t);
+    return SegmentClosestPoints{to_point(q1), to_point(q2), static_cast<float>(s), static_cast<float>(t),
+                                static_cast<float>(std::sqrt(distance_sq(q1, q2)))};
+}
+
+// 点到线段 x + t * d 的最近点参数
+inline double segment_parameter(const Vec3& p, const Vec3& x, const Vec3& d) {
+    const double length_sq = dot(d, d);
+    return length_sq > 0.0 ? clamp01(dot(sub(p, x), d) / length_sq) : 0.0;
+}
+
+// 退化三角形：在三条边上分别求最近点，取最近的一个
+TriangleClosestPoint closest_on_degenerate_triangle(const Vec3& p, const Vec3& a, const Vec3& b, const Vec3& c) {
+    const Vec3 ab = sub(b, a), ac = sub(c, a), bc = sub(c, b);
+    const double t_ab = segment_parameter(p, a, ab);
+    const double t_ac = segment_parameter(p, a, ac);
+    const double t_bc = segment_parameter(p, b, bc);
+    const Vec3 on_ab = along(a, ab, t_ab), on_ac = along(a, ac, t_ac), on_bc = along(b, bc, t_bc);
+    Vec3 best = on_ab;
+    double best_sq = distance_sq(p, on_ab), u = t_ab, v = 0.0;
+    if (distance_sq(p, on_ac) < best_sq) {
+        best = on_ac;
+        best_sq = distance_sq(p, on_ac);
+        u = 0.0;
+        v = t_ac;
+    }
+    if (distance_sq(p, on_bc) < best_sq) {
+        best = on_bc;
+        best_sq = distance_sq(p, on_bc);
+        u = 1.0 - t_bc;
+        v = t_bc;
+    }
+    return TriangleClosestPoint{to_point(best), static_cast<float>(u), static_cast<float>(v),
+                                static_cast<float>(std::sqrt(best_sq))};
+}
+
+// Ericson《Real-Time Collision Detection》5.1.5：依次判断点落在哪个顶点、边或面的 Voronoi 区域
+TriangleClosestPoint closest_on_triangle(const Point& point, const Point& pa, const Point& pb,
+                                         const Point& pc) noexcept {
+    const Vec3 p = to_vec3(point), a = to_vec3(pa), b = to_vec3(pb), c = to_vec3(pc);
+    const Vec3 ab = sub(b, a), ac = sub(c, a);
+    // va + vb + vc = |ab × ac|²，为0时三角形退化，下面的除法没有意义
+    const double ab_sq = dot(ab, ab), ac_sq = dot(ac, ac), ab_ac = dot(ab, ac);
+    if (!(ab_sq * ac_sq - ab_ac * ab_ac > 0.0)) {
+        return closest_on_degenerate_triangle(p, a, b, c);
+    }
+    const auto result = [&p](const Vec3& q, double u, double v) {
+        return TriangleClosestPoint{to_point(q), static_cast<float>(u), static_cast<float>(v),
+                                    static_cast<float>(std::sqrt(distance_sq(p, q)))};
+    };
+
+    const Vec3 ap = sub(p, a);
+    const double d1 = dot(ab, ap), d2 = dot(ac, ap);
+    if (d1 <= 0.0 && d2 <= 0.0) {
+        return result(a, 0.0, 0.0);
+    }
+    const Vec3 bp = sub(p, b);
+    const double d3 = dot(ab, bp), d4 = dot(ac, bp);
+    if (d3 >= 0.0 && d4 <= d3) {
+        return result(b, 1.0, 0.0);
+    }
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+        const double w = d1 / (d1 - d3);
+        return result(along(a, ab, w), w, 0.0);
+    }
+    const Vec3 cp = sub(p, c);
+    const double d5 = dot(ab, cp), d6 = dot(ac, cp);
+    if (d6 >= 0.0 && d5 <= d6) {
+        return result(c, 0.0, 1.0);
+    }
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+        const double w = d2 / (d2 - d6);
+        return result(along(a, ac, w), 0.0, w);
+    }
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && d4 - d3 >= 0.0 && d5 - d6 >= 0.0) {
+        const double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return result(along(b, sub(c, b), w), 1.0 - w, w);
+    }
+    const double inv = 1.0 / (va + vb + vc);
+    const double u = vb * inv, v = vc * inv;
+    return result(along(along(a, ab, u), ac, v), u, v);
+}
+
+
+// 按中位数划分的 k-d 树：每个结点沿包围盒最长的轴把点对半分开，叶子最多 kLeafSize 个点。
+// 划分位置由数据本身决定，聚集的点与远处的离群点不会挤进同一个桶
+class NeighborTree {
+public:
+    static constexpr std::size_t kLeafSize = 16;
+
+    explicit NeighborTree(const std::vector<Vec3>& pts) : items_(pts.size()), leaf_of_(pts.size()) {
+        for (std::size_t i = 0; i < pts.size(); ++i) {
+            items_[i] = {pts[i], i};
+        }
+        nodes_.reserve(4 * (pts.size() / kLeafSize + 1));
+        build(0, pts.size(), kNone);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return items_.size(); }
+
+    // 叶子顺序中第 k 个点在输入中的下标；空间上相邻的点在叶子顺序中也大体相邻
+    [[nodiscard]] std::size_t index(std::size_t k) const noexcept { return items_[k].index; }
+
+    // 离叶子顺序中第 k 个点最近的其他点，返回它在输入中的下标。先扫描所在的叶子得到上界，
+    // 再逐层向上检查兄弟子树；以当前最近距离为半径的球落在某个祖先的包围盒内时，更外面的点都不会更近
+    [[nodiscard]] std::size_t nearest(std::size_t k, double& best_sq) const {
+        const Vec3& p = items_[k].point;
+        best_sq = std::numeric_limits<double>::max();
+        std::size_t best = kNone;
+        const auto scan = [&](const Node& leaf) {
+            for (std::size_t m = leaf.begin; m < leaf.end; ++m) {
+                const double d = distance_sq(p, items_[m].point);
+                if (d < best_sq && m != k) {
+                    best_sq = d;
+                    best = m;
+                }
+            }
+        };
+
+        std::size_t current = leaf_of_[k];
+        scan(nodes_[current]);
+        std::size_t stack[128];
+        while (nodes_[current].parent != kNone && !inside(nodes_[current], p, best_sq)) {
+            const Node& parent = nodes_[nodes_[current].parent];
+            std::size_t top = 0;
+            stack[top++] = parent.left == current ? parent.right : parent.left;
+            while (top > 0) {
+                const Node& node = nodes_[stack[--top]];
+                if (box_distance_sq(node, p) >= best_sq) {
+                    continue;
+                }
+                if (node.left == kNone) {
+                    scan(node);
+                    continue;
+                }
+                // 较近的子结点后入栈，先被处理
+                if (box_distance_sq(nodes_[node.left], p) <= box_distance_sq(nodes_[node.right], p)) {
+                    stack[top++] = node.right;
+                    stack[top++] = node.left;
+                } else {
+                    stack[top++] = node.left;
+                    stack[top++] = node.right;
+                }
+            }
+            current = nodes_[current].parent;
+        }
+        return items_[best].index;
+    }
+
+private:
+    struct Item {
+        Vec3 point;
+        std::size_t index = 0;
+    };
+
+    struct Node {
+        Vec3 lo, hi;
+        std::size_t begin = 0, end = 0;
+        std::size_t left = kNone, right = kNone, parent = kNone;
+    };
+
+    std::vector<Item> items_;
+    std::vector<std::size_t> leaf_of_;
+    std::vector<Node> nodes_;
+
+    static double box_distance_sq(const Node& node, const Vec3& p) noexcept {
+        const double dx = std::max({node.lo.x - p.x, 0.0, p.x - node.hi.x});
+        const double dy = std::max({node.lo.y - p.y, 0.0, p.y - node.hi.y});
+        const double dz = std::max({node.lo.z - p.z, 0.0, p.z - node.hi.z});
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    // 以 p 为球心、平方半径为 radius_sq 的球是否落在结点的包围盒内
+    static bool inside(const Node& node, const Vec3& p, double radius_sq) noexcept {
+        const double margin = std::min({p.x - node.lo.x, node.hi.x - p.x, p.y - node.lo.y, node.hi.y - p.y,
+                                        p.z - node.lo.z, node.hi.z - p.z});
+        return margin > 0.0 && margin * margin >= radius_sq;
+    }
+
+    // 深度不超过 log2(n / kLeafSize) + 2，递归即可
+    std::size_t build(std::size_t begin, std::size_t end, std::size_t parent) {
+        const std::size_t index = nodes_.size();
+        nodes_.emplace_back();
+        Vec3 lo = items_[begin].point, hi = lo;
+        for (std::size_t k = begin + 1; k < end; ++k) {
+            const Vec3& q = items_[k].point;
+            lo = {std::min(lo.x, q.x), std::min(lo.y, q.y), std::min(lo.z, q.z)};
+            hi = {std::max(hi.x, q.x), std::max(hi.y, q.y), std::max(hi.z, q.z)};
+        }
+        Node& node = nodes_[index];
+        node.lo = lo;
+        node.hi = hi;
+        node.begin = begin;
+        node.end = end;
+        node.parent = parent;
+        if (end - begin <= kLeafSize) {
+            std::fill(leaf_of_.begin() + static_cast<std::ptrdiff_t>(begin),
+                      leaf_of_.begin() + static_cast<std::ptrdiff_t>(end), index);
+            return index;
+        }
+
+        const double extent[3] = {hi.x - lo.x, hi.y - lo.y, hi.z - lo.z};
+        const int axis = static_cast<int>(std::max_element(extent, extent + 3) - extent);
+        const std::size_t mid = begin + (end - begin) / 2;
+        const auto first = items_.begin() + static_cast<std::ptrdiff_t>(begin);
+        const auto middle = items_.begin() + static_cast<std::ptrdiff_t>(mid);
+        const auto last = items_.begin() + static_cast<std::ptrdiff_t>(end);
+        if (axis == 0) {
+            std::nth_element(first, middle, last, [](const Item& a, const Item& b) { return a.point.x < b.point.x; });
+        } else if (axis == 1) {
+            std::nth_element(first, middle, last, [](const Item& a, const Item& b) { return a.point.y < b.point.y; });
+        } else {
+            std::nth_element(first, middle, last, [](const Item& a, const Item& b) { return a.point.z < b.point.z; });
+        }
+        const std::size_t left = build(begin, mid, index);
+        const std::size_t right = build(mid, end, index);
+        nodes_[index].left = left;
+        nodes_[index].right = right;
+        return index;
+    }
+};
+} // namespace
+
+ClosestPair closest_pair(const std::vector<Point>& points, std::uint32_t seed) {
+    const std::size_t n = points.size();
+    if (n < 2) {
+        throw std::invalid_argument("Closest pair requires at least two points");
+    }
+
+    const std::vector<Vec3> pts = to_vec3(points);
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::mt19937 rng(seed);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    Vec3 origin = pts[0];
+    for (const auto& p : pts) {
+        origin.x = std::min(origin.x, p.x);
+        origin.y = std::min(origin.y, p.y);
+        origin.z = std::min(origin.z, p.z);
+    }
+
+    std::size_t best_a = order[0], best_b = order[1];
+    double best_sq = distance_sq(pts[best_a], pts[best_b]);
+    if (best_sq == 0.0) {
+        return make_pair_result(best_a, best_b, 0.0);
+    }
+
+    PairGrid grid(pts, origin);
+    grid.reset(std::sqrt(best_sq));
+    grid.insert(order[0]);
+    grid.insert(order[1]);
+
+    // 随机顺序下最近距离只会期望 O(log n) 次变小，每次变小时按新边长重建网格
+    for (std::size_t i = 2; i < n; ++i) {
+        const std::size_t index = order[i];
+        const std::size_t found = grid.nearest(pts[index], best_sq);
+        if (found != kNone) {
+            best_a = found;
+            best_b = index;
+            if (best_sq == 0.0) {
+                return make_pair_result(best_a, best_b, 0.0);
+            }
+            grid.reset(std::sqrt(best_sq));
+            for (std::size_t k = 0; k < i; ++k) {
+                grid.insert(order[k]);
+            }
+        }
+        grid.insert(index);
+    }
+    return make_pair_result(best_a, best_b, best_sq);
+}
+
+std::vector<NearestNeighbor> all_nearest_neighbors(const std::vector<Point>& points) {
+    const std::size_t n = points.size();
+    if (n < 2) {
+        throw std::invalid_argument("Nearest neighbor queries require at least two points");
+    }
+
+    const std::vector<Vec3> pts = to_vec3(points);
+    const NeighborTree tree(pts);
+    std::vector<NearestNeighbor> result(n);
+
+    // 按叶子顺序分块，相邻查询访问的结点大体相同
+    parallel_for(n, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t k = begin; k < end; ++k) {
+            double best_sq = 0.0;
+            const std::size_t best = tree.nearest(k, best_sq);
+            result[tree.index(k)] = {best, static_cast<float>(std::sqrt(best_sq))};
+        }
+    }, 256);
+    return result;
+}
+
+SegmentClosestPoints segment_closest_points(const Line& first, const Line& second) noexcept {
+    return closest_on_segments(first, second);
+}
+
+TriangleClosestPoint triangle_closest_point(const Point& point, const Point& a, const Point& b,
+                                            const Point& c) noexcept {
+    return closest_on_triangle(point, a, b, c);
+}
+
+void segment_closest_points(const Line* first, const Line* second, std::size_t count, SegmentClosestPoints* out) {
+    parallel_for(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            out[i] = closest_on_segments(first[i], second[i]);
+        }
+    }, kClosestChunk);
+}
+
+void triangle_closest_points(const Point* points, const Point* corners, std::size_t count,
+                             TriangleClosestPoint* out) {
+    parallel_for(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            out[i] = closest_on_triangle(points[i], corners[3 * i], corners[3 * i + 1], corners[3 * i + 2]);
+        }
+    }, kClosestChunk);
+}
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,210 @@
+#include "utils/ransac.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kBlock = 1024;
+
+// 每轮评估的假设数。自适应终止只在每轮结束时检查，所以它必须与线程数无关，
+// 否则评估的假设数随机器变化，相同种子得到不同的结果
+constexpr std::size_t kHypothesisBatch = 64;
+
+// 分块批量计算距离并计数内点；剩余的点全部算作内点也达不到 bar 时提前返回（此时结果小于 bar）
+std::size_t count_inliers(const Plane& plane, const Point* points, std::size_t count, float threshold,
+                          std::size_t bar) noexcept {
+    float dist[kBlock];
+    std::size_t inliers = 0;
+    for (std::size_t begin = 0; begin < count; begin += kBlock) {
+        const std::size_t n = std::min(kBlock, count - begin);
+        plane.signed_distances(points + begin, n, dist);
+        for (std::size_t k = 0; k < n; ++k) {
+            inliers += std::abs(dist[k]) <= threshold;
+        }
+        if (inliers + (count - begin - n) < bar) {
+            return inliers;
+        }
+    }
+    return inliers;
+}
+
+// 并行计算所有点的距离，把内点标记为1
+std::size_t mark_inliers(const Plane& plane, const std::vector<Point>& points, float threshold,
+                         std::vector<std::uint8_t>& mask) {
+    mask.assign(points.size(), 0);
+    std::atomic<std::size_t> total{0};
+    parallel_for(points.size(), [&](std::size_t begin, std::size_t end) {
+        float dist[kBlock];
+        std::size_t inliers = 0;
+        for (std::size_t i = begin; i < end; i += kBlock) {
+            const std::size_t n = std::min(kBlock, end - i);
+            plane.signed_distances(points.data() + i, n, dist);
+            for (std::size_t k = 0; k < n; ++k) {
+                const bool inside = std::abs(dist[k]) <= threshold;
+                mask[i + k] = inside;
+                inliers += inside;
+            }
+        }
+        total += inliers;
+    }, 1 << 14);
+    return total;
+}
+
+// 第 plane 个平面的第 index 个假设：与线程划分无关，保证结果可复现
+bool make_hypothesis(const std::vector<Point>& points, std::uint32_t seed, std::size_t plane, std::size_t index,
+                     Point& normal, Point& anchor) {
+    std::seed_seq sequence{seed, static_cast<std::uint32_t>(plane), static_cast<std::uint32_t>(index),
+                           static_cast<std::uint32_t>(static_cast<std::uint64_t>(index) >> 32)};
+    std::mt19937 rng(sequence);
+    std::uniform_int_distribution<std::size_t> pick(0, points.size() - 1);
+    const std::size_t a = pick(rng);
+    std::size_t b = pick(rng);
+    while (b == a) {
+        b = pick(rng);
+    }
+    std::size_t c = pick(rng);
+    while (c == a || c == b) {
+        c = pick(rng);
+    }
+    const Point ab = points[b] - points[a];
+    const Point ac = points[c] - points[a];
+    const Point n = cross_product(ab, ac);
+    // 三点接近共线时法向量不可靠，放弃这个假设
+    const double length = n.magnitude();
+    if (!(length > 1e-6 * ab.magnitude() * ac.magnitude())) {
+        return false;
+    }
+    normal = n / length;
+    anchor = points[a];
+    return true;
+}
+
+} // namespace
+
+std::vector<DetectedPlane> detect_planes(const std::vector<Point>& points, const PlaneDetectionOptions& options) {
+    if (!(options.threshold > 0.0f)) {
+        throw std::invalid_argument("RANSAC threshold must be positive");
+    }
+    if (!(options.confidence > 0.0 && options.confidence < 1.0)) {
+        throw std::invalid_argument("RANSAC confidence must be in (0, 1)");
+    }
+    if (points.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("Too many points for detect_planes");
+    }
+
+    std::vector<DetectedPlane> result;
+    std::vector<Point> remaining = points;
+    std::vector<std::uint32_t> ids(points.size());
+    std::iota(ids.begin(), ids.end(), 0u);
+
+    std::vector<std::size_t> scores(kHypothesisBatch);
+    std::vector<Point> normals(kHypothesisBatch), anchors(kHypothesisBatch);
+    std::vector<std::uint8_t> mask;
+    const double log_failure = std::log(1.0 - options.confidence);
+
+    while (result.size() < options.max_planes && remaining.size() >= std::max<std::size_t>(3, options.min_inliers)) {
+        const std::size_t n = remaining.size();
+        // 内点数达不到 min_inliers 的假设没有意义，从一开始就可以按它放弃
+        const std::size_t min_inliers = std::max<std::size_t>(3, options.min_inliers);
+        std::atomic<std::size_t> bar{min_inliers};
+        std::size_t best_score = 0;
+        Point best_normal, best_anchor;
+        std::size_t tried = 0;
+        std::size_t needed = options.max_iterations;
+
+        // 点少时单个假设太便宜，让每个线程多评估几个以摊薄线程开销
+        const std::size_t min_chunk = std::max<std::size_t>(1, (std::size_t{1} << 16) / n);
+        while (tried < needed) {
+            const std::size_t round = std::min(kHypothesisBatch, needed - tried);
+            parallel_for(round, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t k = begin; k < end; ++k) {
+                    scores[k] = 0;
+                    if (!make_hypothesis(remaining, options.seed, result.size(), tried + k, normals[k], anchors[k])) {
+                        continue;
+                    }
+                    const Plane plane(normals[k], anchors[k]);
+                    scores[k] = count_inliers(plane, remaining.data(), n, options.threshold,
+                                              bar.load(std::memory_order_relaxed));
+                    std::size_t current = bar.load(std::memory_order_relaxed);
+                    while (scores[k] > current && !bar.compare_exchange_weak(current, scores[k])) {
+                    }
+                }
+            }, min_chunk);
+
+            // 中途放弃的假设得分严格小于当时的最优值（或 min_inliers），按下标顺序取最优即可得到确定的结果
+            for (std::size_t k = 0; k < round; ++k) {
+                if (scores[k] > best_score) {
+                    best_score = scores[k];
+                    best_normal = normals[k];
+                    best_anchor = anchors[k];
+                }
+            }
+            tried += round;
+
+            // 内点比例为 w 时一次抽到3个内点的概率为 w^3，据此更新所需的假设数；
+            // 比 min_inliers 还小的平面不会被接受，所以 w 至少按 min_inliers 估计
+            const double w = static_cast<double>(std::max(best_score, min_inliers)) / static_cast<double>(n);
+            const double all_inliers = w * w * w;
+            if (all_inliers >= 1.0) {
+                needed = tried;
+            } else {
+                const double estimate = std::ceil(log_failure / std::log1p(-all_inliers));
+                needed = estimate < static_cast<double>(options.max_iterations)
+                             ? std::max(tried, static_cast<std::size_t>(estimate))
+                             : options.max_iterations;
+            }
+        }
+        if (best_score < min_inliers) {
+            break;
+        }
+
+        // 用全部内点重新拟合；拟合后内点变少时保留原假设
+        Plane plane(best_normal, best_anchor);
+        std::size_t inliers = mark_inliers(plane, remaining, options.threshold, mask);
+        std::vector<Point> support;
+        support.reserve(inliers);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (mask[i]) {
+                support.push_back(remaining[i]);
+            }
+        }
+        if (auto refined = Plane::fit(support.data(), support.size())) {
+            std::vector<std::uint8_t> refined_mask;
+            const std::size_t refined_inliers = mark_inliers(*refined, remaining, options.threshold, refined_mask);
+            if (refined_inliers >= inliers) {
+                plane = *refined;
+                inliers = refined_inliers;
+                mask.swap(refined_mask);
+            }
+        }
+
+        DetectedPlane detected{plane, {}};
+        detected.inliers.reserve(inliers);
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (mask[i]) {
+                detected.inliers.push_back(ids[i]);
+            } else {
+                remaining[kept] = remaining[i];
+                ids[kept] = ids[i];
+                ++kept;
+            }
+        }
+        remaining.resize(kept);
+        ids.resize(kept);
+        result.push_back(std::move(detected));
+    }
+    return result;
+}
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,262 @@
+#include "utils/raycast.h"
+#include "utils/parallel.h"
+#include <atomic>
+#include <cmath>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+constexpr float kParallel = 1e-6f;
+constexpr std::size_t kRayChunk = 1 << 12;
+
+// 标量版本：运算顺序与 SSE2 版本相同，两条路径的结果逐位一致
+inline float ray_plane_t(const RayBatch& rays, std::size_t r, float a, float b, float c, float d, float t_min,
+                         float t_max) noexcept {
+    const float denom = a * rays.dx[r] + b * rays.dy[r] + c * rays.dz[r];
+    const float t = -(a * rays.ox[r] + b * rays.oy[r] + c * rays.oz[r] + d) / denom;
+    const bool hit = std::abs(denom) >= kParallel && t >= t_min && t <= t_max;
+    return hit ? t : std::numeric_limits<float>::infinity();
+}
+
+#if defined(__SSE2__)
+// 4条射线的起点与方向
+struct Rays4 {
+    __m128 ox, oy, oz, dx, dy, dz;
+
+    Rays4(const RayBatch& rays, std::size_t r)
+        : ox(_mm_loadu_ps(rays.ox.data() + r)), oy(_mm_loadu_ps(rays.oy.data() + r)),
+          oz(_mm_loadu_ps(rays.oz.data() + r)), dx(_mm_loadu_ps(rays.dx.data() + r)),
+          dy(_mm_loadu_ps(rays.dy.data() + r)), dz(_mm_loadu_ps(rays.dz.data() + r)) {}
+};
+
+// 4条射线与同一个平面的交点参数，hit 为有效命中的掩码
+inline __m128 ray_plane_t4(const Rays4& rays, std::size_t p, const PlaneCoefficients& planes, __m128 t_min,
+                           __m128 t_max, __m128& hit) noexcept {
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 a = _mm_set1_ps(planes.a[p]), b = _mm_set1_ps(planes.b[p]);
+    const __m128 c = _mm_set1_ps(planes.c[p]), d = _mm_set1_ps(planes.d[p]);
+    const __m128 denom = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, rays.dx), _mm_mul_ps(b, rays.dy)), _mm_mul_ps(c, rays.dz));
+    const __m128 dist = _mm_add_ps(
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, rays.ox), _mm_mul_ps(b, rays.oy)), _mm_mul_ps(c, rays.oz)), d);
+    const __m128 t = _mm_div_ps(_mm_xor_ps(dist, sign), denom);
+    hit = _mm_and_ps(_mm_cmpge_ps(_mm_andnot_ps(sign, denom), _mm_set1_ps(kParallel)),
+                     _mm_and_ps(_mm_cmpge_ps(t, t_min), _mm_cmple_ps(t, t_max)));
+    return t;
+}
+
+inline __m128 select(__m128 mask, __m128 a, __m128 b) noexcept {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// 参数有限（真正命中）的通道数
+inline std::size_t finite_lanes(__m128 t) noexcept {
+    const int mask = _mm_movemask_ps(_mm_cmplt_ps(t, _mm_set1_ps(std::numeric_limits<float>::infinity())));
+    return static_cast<std::size_t>((mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + ((mask >> 3) & 1));
+}
+#endif
+
+} // namespace
+
+RayBatch::RayBatch(const std::vector<Line>& lines) {
+    reserve(lines.size());
+    for (const Line& line : lines) {
+        push_back(line);
+    }
+}
+
+void RayBatch::push_back(const Point& origin, const Point& direction) {
+    ox.push_back(origin.x);
+    oy.push_back(origin.y);
+    oz.push_back(origin.z);
+    dx.push_back(direction.x);
+    dy.push_back(direction.y);
+    dz.push_back(direction.z);
+}
+
+void RayBatch::push_back(const Line& line) {
+    push_back(line.start, line.end - line.start);
+}
+
+std::size_t RayBatch::size() const noexcept {
+    return ox.size();
+}
+
+void RayBatch::reserve(std::size_t count) {
+    ox.reserve(count);
+    oy.reserve(count);
+    oz.reserve(count);
+    dx.reserve(count);
+    dy.reserve(count);
+    dz.reserve(count);
+}
+
+std::size_t ray_plane_hits(const RayBatch& rays, const PlaneCoefficients& planes, float* t_out, float t_min,
+                           float t_max) {
+    const std::size_t ray_count = rays.size();
+    const std::size_t plane_count = planes.size();
+    std::atomic<std::size_t> total{0};
+    parallel_for(ray_count, [&](std::size_t begin, std::size_t end) {
+        std::size_t hits = 0;
+        std::size_t r = begin;
+#if defined(__SSE2__)
+        const __m128 lo = _mm_set1_ps(t_min), hi = _mm_set1_ps(t_max);
+        const __m128 miss = _mm_set1_ps(std::numeric_limits<float>::infinity());
+        for (; r + 4 <= end; r += 4) {
+            const Rays4 group(rays, r);
+            for (std::size_t p = 0; p < plane_count; ++p) {
+                __m128 hit;
+                const __m128 t = ray_plane_t4(group, p, planes, lo, hi, hit);
+                const __m128 result = select(hit, t, miss);
+                _mm_storeu_ps(t_out + p * ray_count + r, result);
+                hits += finite_lanes(result);
+            }
+        }
+#endif
+        for (; r < end; ++r) {
+            for (std::size_t p = 0; p < plane_count; ++p) {
+                const float t = ray_plane_t(rays, r, planes.a[p], planes.b[p], planes.c[p], planes.d[p], t_min, t_max);
+                t_out[p * ray_count + r] = t;
+                hits += t != std::numeric_limits<float>::infinity();
+            }
+        }
+        total += hits;
+    }, kRayChunk);
+    return total;
+}
+
+std::size_t closest_ray_plane_hits(const RayBatch& rays, const PlaneCoefficients& planes, float* t_out,
+                                   std::uint32_t* plane_out, float t_min, float t_max) {
+    const std::size_t ray_count = rays.size();
+    const std::size_t plane_count = planes.size();
+    std::atomic<std::size_t> total{0};
+    parallel_for(ray_count, [&](std::size_t begin, std::size_t end) {
+        std::size_t hits = 0;
+        std::size_t r = begin;
+#if defined(__SSE2__)
+        const __m128 lo = _mm_set1_ps(t_min), hi = _mm_set1_ps(t_max);
+        for (; r + 4 <= end; r += 4) {
+            const Rays4 group(rays, r);
+            __m128 best_t = _mm_set1_ps(std::numeric_limits<float>::infinity());
+            __m128i best_id = _mm_set1_epi32(static_cast<int>(kNoHit));
+            for (std::size_t p = 0; p < plane_count; ++p) {
+                __m128 hit;
+                const __m128 t = ray_plane_t4(group, p, planes, lo, hi, hit);
+                // 严格小于才替换，参数相同时保留下标较小的平面
+                const __m128 closer = _mm_and_ps(hit, _mm_cmplt_ps(t, best_t));
+                best_t = select(closer, t, best_t);
+                const __m128i take = _mm_castps_si128(closer);
+                best_id = _mm_or_si128(_mm_and_si128(take, _mm_set1_epi32(static_cast<int>(p))),
+                                       _mm_andnot_si128(take, best_id));
+            }
+            _mm_storeu_ps(t_out + r, best_t);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(plane_out + r), best_id);
+            hits += finite_lanes(best_t);
+        }
+#endif
+        for (; r < end; ++r) {
+            float best_t = std::numeric_limits<float>::infinity();
+            std::uint32_t best_id = kNoHit;
+            for (std::size_t p = 0; p < plane_count; ++p) {
+                const float t = ray_plane_t(rays, r, planes.a[p], planes.b[p], planes.c[p], planes.d[p], t_min, t_max);
+                if (t < best_t) {
+                    best_t = t;
+                    best_id = static_cast<std::uint32_t>(p);
+                }
+            }
+            t_out[r] = best_t;
+            plane_out[r] = best_id;
+            hits += best_id != kNoHit;
+        }
+        total += hits;
+    }, kRayChunk);
+    return total;
+}
+
+std::optional<RayTriangleHit> ray_triangle(const Point& origin, const Point& direction, const Point& a,
+                                           const Point& b, const Point& c, float t_min, float t_max) noexcept {
+    // 运算顺序与 TriangleBvh 的4路 SSE2 版本相同，单条射线与射线包的结果逐位一致
+    const float e1x = b.x - a.x, e1y = b.y - a.y, e1z = b.z - a.z;
+    const float e2x = c.x - a.x, e2y = c.y - a.y, e2z = c.z - a.z;
+    const float px = direction.y * e2z - direction.z * e2y;
+    const float py = direction.z * e2x - direction.x * e2z;
+    const float pz = direction.x * e2y - direction.y * e2x;
+    const float det = e1x * px + e1y * py + e1z * pz;
+    if (!(det < 0.0f || det > 0.0f)) {
+        return std::nullopt;
+    }
+    const float inv = 1.0f / det;
+    const float sx = origin.x - a.x, sy = origin.y - a.y, sz = origin.z - a.z;
+    const float u = (sx * px + sy * py + sz * pz) * inv;
+    const float qx = sy * e1z - sz * e1y;
+    const float qy = sz * e1x - sx * e1z;
+    const float qz = sx * e1y - sy * e1x;
+    const float v = (direction.x * qx + direction.y * qy + direction.z * qz) * inv;
+    const float t = (e2x * qx + e2y * qy + e2z * qz) * inv;
+    if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t >= t_min && t <= t_max) {
+        return RayTriangleHit{t, u, v};
+    }
+    return std::nullopt;
+}
+
+std::optional<RayTriangleHit> ray_triangle_watertight(const Point& origin, const Point& direction, const Point& a,
+                                                      const Point& b, const Point& c, float t_min,
+                                                      float t_max) noexcept {
+    // 方向分量绝对值最大的轴作为 z 轴，其余两轴保持右手系
+    const float d[3] = {direction.x, direction.y, direction.z};
+    int kz = 0;
+    if (std::abs(d[1]) > std::abs(d[kz])) {
+        kz = 1;
+    }
+    if (std::abs(d[2]) > std::abs(d[kz])) {
+        kz = 2;
+    }
+    int kx = (kz + 1) % 3;
+    int ky = (kx + 1) % 3;
+    if (d[kz] < 0.0f) {
+        std::swap(kx, ky);
+    }
+    const float shear_x = d[kx] / d[kz];
+    const float shear_y = d[ky] / d[kz];
+    const float shear_z = 1.0f / d[kz];
+
+    const float A[3] = {a.x - origin.x, a.y - origin.y, a.z - origin.z};
+    const float B[3] = {b.x - origin.x, b.y - origin.y, b.z - origin.z};
+    const float C[3] = {c.x - origin.x, c.y - origin.y, c.z - origin.z};
+    const float ax = A[kx] - shear_x * A[kz], ay = A[ky] - shear_y * A[kz];
+    const float bx = B[kx] - shear_x * B[kz], by = B[ky] - shear_y * B[kz];
+    const float cx = C[kx] - shear_x * C[kz], cy = C[ky] - shear_y * C[kz];
+
+    float U = cx * by - cy * bx;
+    float V = ax * cy - ay * cx;
+    float W = bx * ay - by * ax;
+    if (U == 0.0f || V == 0.0f || W == 0.0f) {
+        U = static_cast<float>(static_cast<double>(cx) * by - static_cast<double>(cy) * bx);
+        V = static_cast<float>(static_cast<double>(ax) * cy - static_cast<double>(ay) * cx);
+        W = static_cast<float>(static_cast<double>(bx) * ay - static_cast<double>(by) * ax);
+    }
+    if ((U < 0.0f || V < 0.0f || W < 0.0f) && (U > 0.0f || V > 0.0f || W > 0.0f)) {
+        return std::nullopt;
+    }
+    const float det = U + V + W;
+    if (!(det < 0.0f || det > 0.0f)) {
+        return std::nullopt;
+    }
+    const float az = shear_z * A[kz], bz = shear_z * B[kz], cz = shear_z * C[kz];
+    const float T = U * az + V * bz + W * cz;
+    const float inv = 1.0f / det;
+    const float t = T * inv;
+    if (t >= t_min && t <= t_max) {
+        return RayTriangleHit{t, V * inv, W * inv};
+    }
+    return std::nullopt;
+}
+
+} // namespace utils
+} // namespace geometry
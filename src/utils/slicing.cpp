@@ -0,0 +1,272 @@
+#include "utils/slicing.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+// 三角形沿公共法向量的高度区间
+struct TriangleRange {
+    double lo = 0.0;
+    double hi = 0.0;
+    std::uint32_t triangle = 0;
+};
+
+// 一条有向轮廓线段：从 from 边上的交点指向 to 边上的交点（边用两个端点下标编码）
+struct Segment {
+    std::uint64_t from = 0;
+    std::uint64_t to = 0;
+    Point point; ///< from 边上的交点
+};
+
+inline std::uint64_t edge_key(std::uint32_t a, std::uint32_t b) noexcept {
+    if (a > b) {
+        std::swap(a, b);
+    }
+    return (static_cast<std::uint64_t>(a) << 32) | b;
+}
+
+// 总是从下标较小的端点开始插值，使相邻三角形算出的交点完全相同
+Point edge_point(const std::vector<Point>& vertices, const std::vector<double>& heights, std::uint32_t a,
+                 std::uint32_t b, double level) {
+    if (a > b) {
+        std::swap(a, b);
+    }
+    const double t = (level - heights[a]) / (heights[b] - heights[a]);
+    return vertices[a] + (vertices[b] - vertices[a]) * t;
+}
+
+// 顶点高度不低于 level 视为在平面上方；三角形被穿过时恰好有一条边从上方进入下方、一条边从下方回到上方。
+// 线段从前者指向后者，对外法向量一致的网格得到从平面法向量方向看逆时针的外轮廓
+void cut_triangle(const std::vector<Point>& vertices, const std::vector<std::uint32_t>& triangles,
+                  const std::vector<double>& heights, std::uint32_t triangle, double level,
+                  std::vector<Segment>& out) {
+    const std::uint32_t v[3] = {triangles[3 * triangle], triangles[3 * triangle + 1], triangles[3 * triangle + 2]};
+    const bool above[3] = {heights[v[0]] >= level, heights[v[1]] >= level, heights[v[2]] >= level};
+    if (above[0] == above[1] && above[1] == above[2]) {
+        return;
+    }
+
+    Segment segment;
+    for (int i = 0; i < 3; ++i) {
+        const int j = (i + 1) % 3;
+        if (above[i] && !above[j]) {
+            segment.from = edge_key(v[i], v[j]);
+            segment.point = edge_point(vertices, heights, v[i], v[j], level);
+        } else if (!above[i] && above[j]) {
+            segment.to = edge_key(v[i], v[j]);
+        }
+    }
+    out.push_back(segment);
+}
+
+// 以边编码为键的开放寻址表，每个线程复用同一份缓冲区
+struct StitchScratch {
+    std::vector<std::uint64_t> keys;
+    std::vector<std::uint32_t> slots;
+    std::vector<char> visited;
+    std::vector<char> has_predecessor;
+};
+
+constexpr std::uint64_t kEmptyKey = ~std::uint64_t{0}; // 边编码要求两端点不同，不会等于它
+
+// 把一层的线段按共享的网格边首尾相连
+SliceLayer stitch(const std::vector<Segment>& segments, StitchScratch& scratch) {
+    SliceLayer layer;
+    const std::size_t n = segments.size();
+    std::size_t capacity = 16;
+    while (capacity < 2 * n) {
+        capacity *= 2;
+    }
+    const std::size_t mask = capacity - 1;
+    const auto home = [mask](std::uint64_t key) {
+        return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    };
+
+    scratch.keys.assign(capacity, kEmptyKey);
+    scratch.slots.resize(capacity);
+    scratch.visited.assign(n, 0);
+    scratch.has_predecessor.assign(n, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t h = home(segments[i].from);
+        while (scratch.keys[h] != kEmptyKey) {
+            h = (h + 1) & mask;
+        }
+        scratch.keys[h] = segments[i].from;
+        scratch.slots[h] = static_cast<std::uint32_t>(i);
+    }
+    // 非流形边上可能有多条线段从同一条边出发，依次探测找到未访问的那条
+    const auto successor = [&](std::uint64_t key) {
+        for (std::size_t h = home(key); scratch.keys[h] != kEmptyKey; h = (h + 1) & mask) {
+            if (scratch.keys[h] == key && !scratch.visited[scratch.slots[h]]) {
+                return static_cast<std::size_t>(scratch.slots[h]);
+            }
+        }
+        return n;
+    };
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t h = home(segments[i].to); scratch.keys[h] != kEmptyKey; h = (h + 1) & mask) {
+            if (scratch.keys[h] == segments[i].to) {
+                scratch.has_predecessor[scratch.slots[h]] = 1;
+            }
+        }
+    }
+
+    const auto walk = [&](std::size_t start) {
+        Polygon contour;
+        std::size_t current = start;
+        while (true) {
+            scratch.visited[current] = 1;
+            const Point& p = segments[current].point;
+            if (contour.vertices.empty() || contour.vertices.back() != p) {
+                contour.vertices.push_back(p);
+            }
+            const std::uint64_t key = segments[current].to;
+            if (key == segments[start].from) {
+                if (contour.vertices.size() > 1 && contour.vertices.back() == contour.vertices.front()) {
+                    contour.vertices.pop_back();
+                }
+                // 只在顶点或边上接触平面时会退化成少于3个点，直接丢弃
+                if (contour.vertices.size() >= 3) {
+                    layer.contours.push_back(std::move(contour));
+                }
+                return;
+            }
+            current = successor(key);
+            if (current == n) {
+                ++layer.open_chains;
+                return;
+            }
+        }
+    };
+
+    // 先从没有前驱的线段出发走完开放折线，剩下的都在环上
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!scratch.visited[i] && !scratch.has_predecessor[i]) {
+            walk(i);
+        }
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!scratch.visited[i]) {
+            walk(i);
+        }
+    }
+    return layer;
+}
+
+} // namespace
+
+std::vector<SliceLayer> slice_mesh(const std::vector<Point>& vertices, const std::vector<std::uint32_t>& triangles,
+                                   const std::vector<Plane>& planes) {
+    if (triangles.size() % 3 != 0) {
+        throw std::invalid_argument("Triangle index count must be a multiple of 3");
+    }
+    for (std::uint32_t index : triangles) {
+        if (index >= vertices.size()) {
+            throw std::out_of_range("Triangle vertex index out of range");
+        }
+    }
+    std::vector<SliceLayer> layers(planes.size());
+    if (planes.empty() || triangles.empty()) {
+        return layers;
+    }
+
+    // 所有平面共用第一个平面的法向量，反向的平面换算成同一方向上的高度
+    const Point axis = planes.front().normal;
+    std::vector<double> levels(planes.size());
+    for (std::size_t i = 0; i < planes.size(); ++i) {
+        if (!planes[i].is_parallel_to(planes.front(), 1e-4f)) {
+            throw std::invalid_argument("Slicing planes must be parallel");
+        }
+        const double sign = dot_product(planes[i].normal, axis) > 0.0 ? 1.0 : -1.0;
+        levels[i] = -sign * planes[i].d();
+    }
+
+    std::vector<double> heights(vertices.size());
+    for (std::size_t i = 0; i < vertices.size(); ++i) {
+        heights[i] = static_cast<double>(axis.x) * vertices[i].x + static_cast<double>(axis.y) * vertices[i].y
+                     + static_cast<double>(axis.z) * vertices[i].z;
+    }
+
+    const std::size_t triangle_count = triangles.size() / 3;
+    std::vector<TriangleRange> ranges(triangle_count);
+    for (std::size_t t = 0; t < triangle_count; ++t) {
+        const double h0 = heights[triangles[3 * t]];
+        const double h1 = heights[triangles[3 * t + 1]];
+        const double h2 = heights[triangles[3 * t + 2]];
+        ranges[t] = {std::min({h0, h1, h2}), std::max({h0, h1, h2}), static_cast<std::uint32_t>(t)};
+    }
+    parallel_sort(ranges.begin(), ranges.end(),
+                  [](const TriangleRange& a, const TriangleRange& b) { return a.lo < b.lo; });
+
+    std::vector<std::size_t> order(planes.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return levels[a] < levels[b]; });
+
+    // 每个线程按高度递增扫描自己的一段层，维护与当前平面相交的三角形集合
+    parallel_for(order.size(), [&](std::size_t begin, std::size_t end) {
+        std::vector<std::uint32_t> active;
+        std::vector<Segment> segments;
+        StitchScratch scratch;
+        const double first = levels[order[begin]];
+        std::size_t next = 0;
+        for (; next < ranges.size() && ranges[next].lo <= first; ++next) {
+            if (ranges[next].hi >= first) {
+                active.push_back(static_cast<std::uint32_t>(next));
+            }
+        }
+
+        for (std::size_t k = begin; k < end; ++k) {
+            const double level = levels[order[k]];
+            for (; next < ranges.size() && ranges[next].lo <= level; ++next) {
+                active.push_back(static_cast<std::uint32_t>(next));
+            }
+            active.erase(std::remove_if(active.begin(), active.end(),
+                                        [&](std::uint32_t r) { return ranges[r].hi < level; }),
+                         active.end());
+
+            segments.clear();
+            for (std::uint32_t r : active) {
+                cut_triangle(vertices, triangles, heights, ranges[r].triangle, level, segments);
+            }
+            layers[order[k]] = stitch(segments, scratch);
+        }
+    }, 8);
+    return layers;
+}
+
+std::vector<SliceLayer> slice_mesh(const std::vector<Point>& soup, const std::vector<Plane>& planes) {
+    if (soup.size() % 3 != 0) {
+        throw std::invalid_argument("Triangle soup size must be a multiple of 3");
+    }
+
+    // 按坐标排序后合并完全相同的顶点
+    std::vector<std::uint32_t> order(soup.size());
+    std::iota(order.begin(), order.end(), 0u);
+    const auto less = [&](std::uint32_t a, std::uint32_t b) {
+        const Point& p = soup[a];
+        const Point& q = soup[b];
+        if (p.x != q.x) return p.x < q.x;
+        if (p.y != q.y) return p.y < q.y;
+        return p.z < q.z;
+    };
+    parallel_sort(order.begin(), order.end(), less);
+
+    std::vector<Point> vertices;
+    std::vector<std::uint32_t> triangles(soup.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        if (i == 0 || soup[order[i]] != soup[order[i - 1]]) {
+            vertices.push_back(soup[order[i]]);
+        }
+        triangles[order[i]] = static_cast<std::uint32_t>(vertices.size() - 1);
+    }
+    return slice_mesh(vertices, triangles, planes);
+}
+
+} // namespace utils
+} // namespace geometry
@@ -0,0 +1,199 @@
+#include "utils/spacefill.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+constexpr std::uint64_t kMask2d = 0x5555555555555555ULL;
+constexpr std::uint64_t kMask3d = 0x1249249249249249ULL;
+
+// 把 32 位整数的各位分散到偶数位上
+inline std::uint64_t spread_2d(std::uint32_t v) noexcept {
+#if defined(__BMI2__)
+    return _pdep_u64(v, kMask2d);
+#else
+    std::uint64_t x = v;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x << 2)) & 0x3333333333333333ULL;
+    x = (x | (x << 1)) & kMask2d;
+    return x;
+#endif
+}
+
+// 把 21 位整数的各位分散到每隔两位的位置上
+inline std::uint64_t spread_3d(std::uint32_t v) noexcept {
+#if defined(__BMI2__)
+    return _pdep_u64(v, kMask3d);
+#else
+    std::uint64_t x = v & 0x1FFFFFu;
+    x = (x | (x << 32)) & 0x001F00000000FFFFULL;
+    x = (x | (x << 16)) & 0x001F0000FF0000FFULL;
+    x = (x | (x << 8)) & 0x100F00F00F00F00FULL;
+    x = (x | (x << 4)) & 0x10C30C30C30C30C3ULL;
+    x = (x | (x << 2)) & kMask3d;
+    return x;
+#endif
+}
+
+// Skilling 的 Hilbert 变换：把坐标原地转换为 Hilbert 编码的“转置”形式。
+// 各位的分支用掩码代替，避免随机输入下大量的分支预测失败
+template <int N>
+void axes_to_transpose(std::uint32_t (&axes)[N], int bits) noexcept {
+    const std::uint32_t top = 1u << (bits - 1);
+    for (std::uint32_t q = top; q > 1; q >>= 1) {
+        const std::uint32_t p = q - 1;
+        for (int i = 0; i < N; ++i) {
+            const std::uint32_t set = 0u - ((axes[i] & q) != 0);
+            const std::uint32_t t = (axes[0] ^ axes[i]) & p & ~set;
+            axes[0] ^= (p & set) | t;
+            axes[i] ^= t;
+        }
+    }
+    // 格雷码编码
+    for (int i = 1; i < N; ++i) {
+        axes[i] ^= axes[i - 1];
+    }
+    std::uint32_t t = 0;
+    for (std::uint32_t q = top; q > 1; q >>= 1) {
+        t ^= (q - 1) & (0u - ((axes[N - 1] & q) != 0));
+    }
+    for (int i = 0; i < N; ++i) {
+        axes[i] ^= t;
+    }
+}
+
+void check_dimensions(int dimensions) {
+    if (dimensions != 2 && dimensions != 3) {
+        throw std::invalid_argument("Space-filling curve dimensions must be 2 or 3");
+    }
+}
+
+// 以相同比例把包围盒量化到整数网格后编码
+std::vector<std::uint64_t> encode(const std::vector<Point>& points, CurveType type, int dimensions) {
+    check_dimensions(dimensions);
+    std::vector<std::uint64_t> codes(points.size());
+    if (points.empty()) {
+        return codes;
+    }
+
+    double lo[3] = {points[0].x, points[0].y, points[0].z};
+    double hi[3] = {lo[0], lo[1], lo[2]};
+    for (const auto& p : points) {
+        const double v[3] = {p.x, p.y, p.z};
+        for (int a = 0; a < dimensions; ++a) {
+            lo[a] = std::min(lo[a], v[a]);
+            hi[a] = std::max(hi[a], v[a]);
+        }
+    }
+    double extent = 0.0;
+    for (int a = 0; a < dimensions; ++a) {
+        extent = std::max(extent, hi[a] - lo[a]);
+    }
+    const int bits = dimensions == 2 ? 32 : 21;
+    const double cells = std::ldexp(1.0, bits) - 1.0;
+    const double scale = extent > 0.0 ? cells / extent : 0.0;
+
+    parallel_for(points.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const double v[3] = {points[i].x, points[i].y, points[i].z};
+            std::uint32_t q[3] = {0, 0, 0};
+            for (int a = 0; a < dimensions; ++a) {
+                q[a] = static_cast<std::uint32_t>(std::clamp((v[a] - lo[a]) * scale, 0.0, cells));
+            }
+            if (dimensions == 2) {
+                codes[i] = type == CurveType::Morton ? morton_encode_2d(q[0], q[1]) : hilbert_encode_2d(q[0], q[1]);
+            } else {
+                codes[i] = type == CurveType::Morton ? morton_encode_3d(q[0], q[1], q[2])
+                                                     : hilbert_encode_3d(q[0], q[1], q[2]);
+            }
+        }
+    }, 4096);
+    return codes;
+}
+
+// 按编码稳定地排序下标（编码相同时保持输入顺序）
+std::vector<std::size_t> order_by_codes(const std::vector<std::uint64_t>& codes) {
+    std::vector<std::pair<std::uint64_t, std::size_t>> keyed(codes.size());
+    for (std::size_t i = 0; i < codes.size(); ++i) {
+        keyed[i] = {codes[i], i};
+    }
+    parallel_sort(keyed.begin(), keyed.end());
+
+    std::vector<std::size_t> order(codes.size());
+    for (std::size_t k = 0; k < keyed.size(); ++k) {
+        order[k] = keyed[k].second;
+    }
+    return order;
+}
+
+template <typename T>
+void apply_order(std::vector<T>& items, const std::vector<std::size_t>& order) {
+    std::vector<T> sorted(items.size());
+    parallel_for(order.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t k = begin; k < end; ++k) {
+            sorted[k] = std::move(items[order[k]]);
+        }
+    }, 4096);
+    items.swap(sorted);
+}
+
+} // namespace
+
+std::uint64_t morton_encode_2d(std::uint32_t x, std::uint32_t y) noexcept {
+    return spread_2d(x) | (spread_2d(y) << 1);
+}
+
+std::uint64_t morton_encode_3d(std::uint32_t x, std::uint32_t y, std::uint32_t z) noexcept {
+    return spread_3d(x) | (spread_3d(y) << 1) | (spread_3d(z) << 2);
+}
+
+std::uint64_t hilbert_encode_2d(std::uint32_t x, std::uint32_t y) noexcept {
+    std::uint32_t axes[2] = {x, y};
+    axes_to_transpose(axes, 32);
+    return (spread_2d(axes[0]) << 1) | spread_2d(axes[1]);
+}
+
+std::uint64_t hilbert_encode_3d(std::uint32_t x, std::uint32_t y, std::uint32_t z) noexcept {
+    std::uint32_t axes[3] = {x & 0x1FFFFFu, y & 0x1FFFFFu, z & 0x1FFFFFu};
+    axes_to_transpose(axes, 21);
+    return (spread_3d(axes[0]) << 2) | (spread_3d(axes[1]) << 1) | spread_3d(axes[2]);
+}
+
+std::vector<std::uint64_t> curve_codes(const std::vector<Point>& points, CurveType type, int dimensions) {
+    return encode(points, type, dimensions);
+}
+
+std::vector<std::size_t> curve_order(const std::vector<Point>& points, CurveType type, int dimensions) {
+    return order_by_codes(encode(points, type, dimensions));
+}
+
+void sort_by_curve(std::vector<Point>& points, CurveType type, int dimensions) {
+    apply_order(points, curve_order(points, type, dimensions));
+}
+
+void sort_by_curve(std::vector<Polygon>& polygons, CurveType type, int dimensions) {
+    check_dimensions(dimensions);
+    std::vector<Point> centers(polygons.size());
+    parallel_for(polygons.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto [lo, hi] = polygons[i].bounding_box();
+            centers[i] = Point((lo.x + hi.x) * 0.5f, (lo.y + hi.y) * 0.5f, (lo.z + hi.z) * 0.5f);
+        }
+    }, 1024);
+    apply_order(polygons, curve_order(centers, type, dimensions));
+}
+
+} // namespace utils
+} // namespace geometry
@@ -1,10 +1,131 @@
 #include "utils/utils.h"
+#include "utils/parallel.h"
 #include <algorithm>
+#include <atomic>
 #include <limits>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace geometry {
 namespace utils {
 
+namespace {
+
+// 叉积形式的克莱姆法则：det = n1 · (n2 × n3)，
+// p = -(d1 (n2 × n3) + d2 (n3 × n1) + d3 (n1 × n2)) / det；SSE2 版本按相同顺序运算，结果逐位一致
+inline bool solve_triple(const PlaneCoefficients& planes, const std::uint32_t* triple, float epsilon,
+                         Point& out) noexcept {
+    const std::uint32_t i = triple[0], j = triple[1], k = triple[2];
+    const float a1 = planes.a[i], b1 = planes.b[i], c1 = planes.c[i], d1 = planes.d[i];
+    const float a2 = planes.a[j], b2 = planes.b[j], c2 = planes.c[j], d2 = planes.d[j];
+    const float a3 = planes.a[k], b3 = planes.b[k], c3 = planes.c[k], d3 = planes.d[k];
+
+    const float ux = b2 * c3 - c2 * b3, uy = c2 * a3 - a2 * c3, uz = a2 * b3 - b2 * a3;
+    const float vx = b3 * c1 - c3 * b1, vy = c3 * a1 - a3 * c1, vz = a3 * b1 - b3 * a1;
+    const float wx = b1 * c2 - c1 * b2, wy = c1 * a2 - a1 * c2, wz = a1 * b2 - b1 * a2;
+    const float det = a1 * ux + b1 * uy + c1 * uz;
+    if (!(std::abs(det) >= epsilon)) {
+        out = Point();
+        return false;
+    }
+    out = Point(-(d1 * ux + d2 * vx + d3 * wx) / det,
+                -(d1 * uy + d2 * vy + d3 * wy) / det,
+                -(d1 * uz + d2 * vz + d3 * wz) / det);
+    return true;
+}
+
+#if defined(__SSE2__)
+// 一次求解4组，返回有效掩码（每组一位）
+inline int solve_triples4(const PlaneCoefficients& planes, const std::uint32_t* triples, float epsilon,
+                          Point* out) noexcept {
+    const auto gather = [triples](const std::vector<float>& v, int slot) {
+        return _mm_setr_ps(v[triples[slot]], v[triples[3 + slot]], v[triples[6 + slot]], v[triples[9 + slot]]);
+    };
+    const __m128 a1 = gather(planes.a, 0), b1 = gather(planes.b, 0), c1 = gather(planes.c, 0), d1 = gather(planes.d, 0);
+    const __m128 a2 = gather(planes.a, 1), b2 = gather(planes.b, 1), c2 = gather(planes.c, 1), d2 = gather(planes.d, 1);
+    const __m128 a3 = gather(planes.a, 2), b3 = gather(planes.b, 2), c3 = gather(planes.c, 2), d3 = gather(planes.d, 2);
+
+    const auto cross = [](__m128 p, __m128 q, __m128 r, __m128 s) {
+        return _mm_sub_ps(_mm_mul_ps(p, q), _mm_mul_ps(r, s));
+    };
+    const __m128 ux = cross(b2, c3, c2, b3), uy = cross(c2, a3, a2, c3), uz = cross(a2, b3, b2, a3);
+    const __m128 vx = cross(b3, c1, c3, b1), vy = cross(c3, a1, a3, c1), vz = cross(a3, b1, b3, a1);
+    const __m128 wx = cross(b1, c2, c1, b2), wy = cross(c1, a2, a1, c2), wz = cross(a1, b2, b1, a2);
+    const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a1, ux), _mm_mul_ps(b1, uy)), _mm_mul_ps(c1, uz));
+
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 valid = _mm_cmpge_ps(_mm_andnot_ps(sign, det), _mm_set1_ps(epsilon));
+    const auto coordinate = [&](__m128 u, __m128 v, __m128 w) {
+        const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(d1, u), _mm_mul_ps(d2, v)), _mm_mul_ps(d3, w));
+        return _mm_and_ps(valid, _mm_div_ps(_mm_xor_ps(sum, sign), det));
+    };
+
+    alignas(16) float xs[4], ys[4], zs[4];
+    _mm_store_ps(xs, coordinate(ux, vx, wx));
+    _mm_store_ps(ys, coordinate(uy, vy, wy));
+    _mm_store_ps(zs, coordinate(uz, vz, wz));
+    for (int l = 0; l < 4; ++l) {
+        out[l] = Point(xs[l], ys[l], zs[l]);
+    }
+    return _mm_movemask_ps(valid);
+}
+#endif
+
+} // namespace
+
+PlaneCoefficients::PlaneCoefficients(const std::vector<Plane>& planes) {
+    a.reserve(planes.size());
+    b.reserve(planes.size());
+    c.reserve(planes.size());
+    d.reserve(planes.size());
+    for (const Plane& plane : planes) {
+        push_back(plane);
+    }
+}
+
+void PlaneCoefficients::push_back(const Plane& plane) {
+    a.push_back(plane.normal.x);
+    b.push_back(plane.normal.y);
+    c.push_back(plane.normal.z);
+    d.push_back(plane.d());
+}
+
+std::size_t PlaneCoefficients::size() const noexcept {
+    return a.size();
+}
+
+std::size_t intersections(const PlaneCoefficients& planes, const std::uint32_t* triples, std::size_t count,
+                          Point* out, bool* valid, float epsilon) {
+    std::atomic<std::size_t> total{0};
+    parallel_for(count, [&](std::size_t begin, std::size_t end) {
+        std::size_t found = 0;
+        std::size_t i = begin;
+#if defined(__SSE2__)
+        for (; i + 4 <= end; i += 4) {
+            const int mask = solve_triples4(planes, triples + 3 * i, epsilon, out + i);
+            for (int l = 0; l < 4; ++l) {
+                const bool ok = (mask >> l) & 1;
+                found += ok;
+                if (valid != nullptr) {
+                    valid[i + l] = ok;
+                }
+            }
+        }
+#endif
+        for (; i < end; ++i) {
+            const bool ok = solve_triple(planes, triples + 3 * i, epsilon, out[i]);
+            found += ok;
+            if (valid != nullptr) {
+                valid[i] = ok;
+            }
+        }
+        total.fetch_add(found, std::memory_order_relaxed);
+    }, 1 << 14);
+    return total.load(std::memory_order_relaxed);
+}
+
 float distance(const Point& p1, const Point& p2) noexcept {
     return static_cast<float>(p1.distance_to(p2));
 }
@@ -0,0 +1,213 @@
+#include "utils/voronoi.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace geometry {
+namespace utils {
+
+namespace {
+
+struct V3 {
+    double x = 0.0, y = 0.0, z = 0.0;
+};
+
+constexpr std::uint32_t kNone = 0xFFFFFFFFu;
+
+inline std::size_t next_edge(std::size_t e) { return Triangulation::next_halfedge(e); }
+inline std::size_t prev_edge(std::size_t e) { return Triangulation::prev_halfedge(e); }
+
+// 每个站点的 Delaunay 邻点来源：三角剖分中的一条出边，或共线退化情况下的前后邻点
+struct Adjacency {
+    std::vector<std::uint32_t> outgoing;           ///< 每个顶点的一条出边（kNone 表示不在三角形中）
+    std::vector<std::uint32_t> line_prev, line_next; ///< 所有点共线时沿直线排序后的相邻站点
+};
+
+Adjacency build_adjacency(const Triangulation& tin) {
+    Adjacency adj;
+    const std::size_t n = tin.points.size();
+    if (!tin.triangles.empty()) {
+        adj.outgoing.assign(n, kNone);
+        for (std::size_t e = 0; e < tin.triangles.size(); ++e) {
+            std::uint32_t& slot = adj.outgoing[tin.triangles[e]];
+            if (slot == kNone) {
+                slot = static_cast<std::uint32_t>(e);
+            }
+        }
+        return adj;
+    }
+
+    // 退化情况：所有点共线（或重合），沿直线排序后相邻的不同点互为邻点
+    adj.line_prev.assign(n, kNone);
+    adj.line_next.assign(n, kNone);
+    if (n < 2) {
+        return adj;
+    }
+    const Point& origin = tin.points[0];
+    std::size_t far = 0;
+    double far_sq = -1.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double dx = static_cast<double>(tin.points[i].x) - origin.x;
+        const double dy = static_cast<double>(tin.points[i].y) - origin.y;
+        if (dx * dx + dy * dy > far_sq) {
+            far_sq = dx * dx + dy * dy;
+            far = i;
+        }
+    }
+    const double dir_x = static_cast<double>(tin.points[far].x) - origin.x;
+    const double dir_y = static_cast<double>(tin.points[far].y) - origin.y;
+    std::vector<double> key(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        key[i] = (static_cast<double>(tin.points[i].x) - origin.x) * dir_x
+                 + (static_cast<double>(tin.points[i].y) - origin.y) * dir_y;
+    }
+    std::vector<std::uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&key](std::uint32_t a, std::uint32_t b) { return key[a] < key[b]; });
+
+    // 只有每组重复点中的第一个参与，其余保持 kNone 并得到空单元
+    std::uint32_t previous = kNone;
+    for (std::uint32_t i : order) {
+        if (previous != kNone && tin.points[i].x == tin.points[previous].x
+            && tin.points[i].y == tin.points[previous].y) {
+            adj.line_prev[i] = adj.line_next[i] = i;
+            continue;
+        }
+        if (previous != kNone) {
+            adj.line_prev[i] = previous;
+            adj.line_next[previous] = i;
+        }
+        previous = i;
+    }
+    return adj;
+}
+
+// 绕站点旋转收集所有 Delaunay 邻点；站点在凸包上时需要向两个方向旋转
+bool collect_neighbors(const Triangulation& tin, const Adjacency& adj, std::uint32_t site,
+                       std::vector<std::uint32_t>& neighbors) {
+    neighbors.clear();
+    if (!adj.outgoing.empty()) {
+        const std::uint32_t start = adj.outgoing[site];
+        if (start == kNone) {
+            return false;
+        }
+        std::size_t e = start;
+        bool open = false;
+        do {
+            neighbors.push_back(tin.triangles[next_edge(e)]);
+            const std::int32_t twin = tin.halfedges[prev_edge(e)];
+            if (twin < 0) {
+                neighbors.push_back(tin.triangles[prev_edge(e)]);
+                open = true;
+                break;
+            }
+            e = static_cast<std::size_t>(twin);
+        } while (e != start);
+
+        if (open) {
+            e = start;
+            while (tin.halfedges[e] >= 0) {
+                e = next_edge(static_cast<std::size_t>(tin.halfedges[e]));
+                neighbors.push_back(tin.triangles[next_edge(e)]);
+            }
+        }
+        return true;
+    }
+
+    if (adj.line_prev[site] == site) {
+        return false;
+    }
+    for (std::uint32_t other : {adj.line_prev[site], adj.line_next[site]}) {
+        if (other != kNone) {
+            neighbors.push_back(other);
+        }
+    }
+    return true;
+}
+
+// Sutherland-Hodgman：保留离 site 不比离 other 远的部分
+void clip_bisector(std::vector<V3>& poly, std::vector<V3>& scratch, const V3& site, const V3& other) {
+    const double nx = other.x - site.x, ny = other.y - site.y;
+    const double limit = (nx * nx + ny * ny) * 0.5;
+    const auto side = [&](const V3& p) { return (p.x - site.x) * nx + (p.y - site.y) * ny - limit; };
+
+    scratch.clear();
+    const std::size_t m = poly.size();
+    for (std::size_t i = 0; i < m; ++i) {
+        const V3& a = poly[i];
+        const V3& b = poly[(i + 1) % m];
+        const double sa = side(a), sb = side(b);
+        if (sa <= 0.0) {
+            scratch.push_back(a);
+        }
+        if ((sa < 0.0 && sb > 0.0) || (sa > 0.0 && sb < 0.0)) {
+            const double t = sa / (sa - sb);
+            scratch.push_back({a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t});
+        }
+    }
+    poly.swap(scratch);
+}
+
+std::vector<Polygon> compute_cells(const Triangulation& tin, const std::vector<std::uint32_t>& sites,
+                                   const Polygon& bounds) {
+    const Adjacency adj = build_adjacency(tin);
+
+    // 边界统一为逆时针，使结果单元同样为逆时针
+    std::vector<V3> base;
+    base.reserve(bounds.vertices.size());
+    for (const auto& v : bounds.vertices) {
+        base.push_back({v.x, v.y, v.z});
+    }
+    if (bounds.signed_area() < 0.0f) {
+        std::reverse(base.begin(), base.end());
+    }
+
+    std::vector<Polygon> cells(sites.size());
+    parallel_for(sites.size(), [&](std::size_t begin, std::size_t end) {
+        std::vector<std::uint32_t> neighbors;
+        std::vector<V3> poly, scratch;
+        for (std::size_t k = begin; k < end; ++k) {
+            const std::uint32_t site = sites[k];
+            if (!collect_neighbors(tin, adj, site, neighbors)) {
+                continue;
+            }
+            const V3 s{tin.points[site].x, tin.points[site].y, 0.0};
+            poly = base;
+            for (std::uint32_t other : neighbors) {
+                if (poly.empty()) {
+                    break;
+                }
+                clip_bisector(poly, scratch, s, {tin.points[other].x, tin.points[other].y, 0.0});
+            }
+
+            Polygon& cell = cells[k];
+            cell.vertices.reserve(poly.size());
+            for (const auto& p : poly) {
+                cell.add_vertex(Point(static_cast<float>(p.x), static_cast<float>(p.y), static_cast<float>(p.z)));
+            }
+        }
+    }, 64);
+    return cells;
+}
+
+} // namespace
+
+std::vector<Polygon> voronoi_cells(const Triangulation& tin, const Polygon& bounds) {
+    std::vector<std::uint32_t> sites(tin.points.size());
+    std::iota(sites.begin(), sites.end(), 0u);
+    return compute_cells(tin, sites, bounds);
+}
+
+std::vector<Polygon> voronoi_cells(const Triangulation& tin, const std::vector<std::uint32_t>& sites,
+                                   const Polygon& bounds) {
+    for (std::uint32_t site : sites) {
+        if (site >= tin.points.size()) {
+            throw std::out_of_range("Voronoi site index out of range");
+        }
+    }
+    return compute_cells(tin, sites, bounds);
+}
+
+} // namespace utils
+} // namespace geometry